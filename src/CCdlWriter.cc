@@ -0,0 +1,125 @@
+/*
+ * CCdlWriter.cc
+ *
+ * Copyright 2014-2018 D. Mitch Bailey  cvc at shuharisystem dot com
+ *
+ * This file is part of cvc.
+ *
+ * cvc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * cvc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with cvc.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * You can download cvc from https://github.com/d-m-bailey/cvc.git
+ */
+
+#include "CCdlWriter.hh"
+
+CCdlWriter::CCdlWriter(size_t theBufferSize) {
+	bufferSize = max(theBufferSize, (size_t) 1024);
+	buffer = new char[bufferSize];
+}
+
+CCdlWriter::~CCdlWriter() {
+	Close();
+	delete [] buffer;
+}
+
+bool CCdlWriter::Open(string theFileName) {
+	Close();
+	writeError = false;
+	if ( theFileName.length() > 3 && theFileName.compare(theFileName.length() - 3, 3, ".gz") == 0 ) {
+		gzFile_p = gzopen(theFileName.c_str(), "wb");
+		if ( gzFile_p == NULL ) return false;
+		gzbuffer(gzFile_p, 1 << 18);
+	} else {
+		file.open(theFileName);
+		if ( file.fail() ) return false;
+		stream_p = &file;
+	}
+	return true;
+}
+
+void CCdlWriter::Open(ostream & theOutput) {
+	Close();
+	writeError = false;
+	stream_p = &theOutput;
+}
+
+bool CCdlWriter::Close() {
+	Flush();
+	if ( gzFile_p ) {
+		if ( gzclose(gzFile_p) != Z_OK ) writeError = true;
+		gzFile_p = NULL;
+	}
+	if ( stream_p ) {
+		stream_p->flush();
+		if ( stream_p->fail() ) writeError = true;
+	}
+	if ( file.is_open() ) {
+		file.close();
+		if ( file.fail() ) writeError = true;
+	}
+	stream_p = NULL;
+	lineLength = 0;
+	return ( ! writeError );
+}
+
+void CCdlWriter::WriteDirect(const char * theData, size_t theLength) {
+	if ( gzFile_p ) {
+		// gzwrite returns the number of uncompressed bytes written, 0 on error
+		if ( gzwrite(gzFile_p, theData, theLength) != (int) theLength ) writeError = true;
+	} else if ( stream_p ) {
+		stream_p->write(theData, theLength);
+		if ( stream_p->fail() ) writeError = true;
+	}
+	byteCount += theLength;
+}
+
+void CCdlWriter::Flush() {
+	if ( bufferUsed == 0 ) return;
+	WriteDirect(buffer, bufferUsed);
+	bufferUsed = 0;
+}
+
+void CCdlWriter::NewLine(const char * theData, size_t theLength) {
+	if ( lineLength > 0 ) Write('\n');
+	Write(theData, theLength);
+	lineLength = theLength;
+}
+
+void CCdlWriter::Add(const char * theData, size_t theLength) {
+	if ( lineLength + theLength > maxLength ) {
+		Write("\n+", 2);
+		lineLength = 1;
+	}
+	Write(' ');
+	Write(theData, theLength);
+	lineLength += theLength + 1;
+}
+
+void CCdlWriter::Add(const string & thePrefix, const char * theName) {
+	size_t myNameLength = strlen(theName);
+	size_t myLength = thePrefix.length() + myNameLength;
+	if ( lineLength + myLength > maxLength ) {
+		Write("\n+", 2);
+		lineLength = 1;
+	}
+	Write(' ');
+	Write(thePrefix.data(), thePrefix.length());
+	Write(theName, myNameLength);
+	lineLength += myLength + 1;
+}
+
+void CCdlWriter::EndLine() {
+	if ( lineLength > 0 ) Write('\n');
+	lineLength = 0;
+}
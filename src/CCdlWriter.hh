@@ -0,0 +1,86 @@
+/*
+ * CCdlWriter.hh
+ *
+ * Copyright 2014-2018 D. Mitch Bailey  cvc at shuharisystem dot com
+ *
+ * This file is part of cvc.
+ *
+ * cvc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * cvc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with cvc.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * You can download cvc from https://github.com/d-m-bailey/cvc.git
+ */
+
+#ifndef CCDLWRITER_HH_
+#define CCDLWRITER_HH_
+
+#include "Cvc.hh"
+#include <zlib.h>
+
+// Buffered CDL output with continuation line wrapping.
+// Writes to an existing stream, a plain file, or a gzip file (name ends in ".gz").
+class CCdlWriter {
+	char *	buffer = NULL;
+	size_t	bufferSize;
+	size_t	bufferUsed = 0;
+	ostream *	stream_p = NULL;
+	ofstream	file;
+	gzFile	gzFile_p = NULL;
+	unsigned int	lineLength = 0;
+	bool	writeError = false;
+
+	void Flush();
+	inline void Write(const char * theData, size_t theLength) {
+		if ( bufferUsed + theLength > bufferSize ) {
+			Flush();
+			if ( theLength > bufferSize ) {
+				WriteDirect(theData, theLength);
+				return;
+			}
+		}
+		memcpy(buffer + bufferUsed, theData, theLength);
+		bufferUsed += theLength;
+	}
+	inline void Write(char theData) {
+		if ( bufferUsed == bufferSize ) Flush();
+		buffer[bufferUsed++] = theData;
+	}
+	void WriteDirect(const char * theData, size_t theLength);
+
+public:
+	unsigned int	maxLength = 80;
+	size_t	byteCount = 0;
+
+	CCdlWriter(size_t theBufferSize = 1 << 20);
+	~CCdlWriter();
+
+	bool Open(string theFileName);
+	void Open(ostream & theOutput);
+	bool Close();  // false if any write since Open failed
+
+	// start a new card
+	void NewLine(const char * theData, size_t theLength);
+	inline void NewLine(const char * theData) { NewLine(theData, strlen(theData)); }
+	inline void NewLine(const string & theData) { NewLine(theData.data(), theData.length()); }
+	// add a field to the current card, wrapping with '+' as needed
+	void Add(const char * theData, size_t theLength);
+	inline void Add(const char * theData) { Add(theData, strlen(theData)); }
+	inline void Add(const string & theData) { Add(theData.data(), theData.length()); }
+	// add a field built from a prefix and a name without creating a temporary
+	void Add(const string & thePrefix, const char * theName);
+	// extend the current field
+	inline void Continue(const char * theData, size_t theLength) { Write(theData, theLength); lineLength += theLength; }
+	void EndLine();
+};
+
+#endif /* CCDLWRITER_HH_ */
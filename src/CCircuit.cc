@@ -32,33 +32,36 @@ text_t CCircuit::lastDeviceMap = NULL;
 CTextDeviceIdMap CCircuit::localDeviceIdMap;
 text_t CCircuit::lastSubcircuitMap = NULL;
 CTextDeviceIdMap CCircuit::localSubcircuitIdMap;
+CTextNetIdMap CCircuit::signalIdBuildMap;
 
 void CCircuit::AddPortSignalIds(CTextList * thePortList_p) {
 	for (CTextList::iterator text_pit = thePortList_p->begin(); text_pit != thePortList_p->end(); ++text_pit) {
-		if ( localSignalIdMap.count(*text_pit) > 0 ) {
+		if ( signalIdBuildMap.count(*text_pit) > 0 ) {
 			stringstream myErrorMessage;
 			myErrorMessage << "duplicate port " << *text_pit << " in " << name << endl;
 			throw EFatalError(myErrorMessage.str());
 		}
-		localSignalIdMap[*text_pit] = portCount++;
+		signalIdBuildMap[*text_pit] = portCount++;
 	}
 }
 
-void CCircuit::SetSignalIds(CTextList * signalList_p, CNetIdVector& signalId_v ) {
+void CCircuit::SetSignalIds(CTextList * signalList_p, CNetIdSpan& signalId_v ) {
 	netId_t mySignalId;
 
-	signalId_v.reserve(signalList_p->size());
+	assert(signalIdPool_v.size() + signalList_p->size() <= signalIdPool_v.capacity());  // reallocation would invalidate spans
+	size_t myFirstSignal = signalIdPool_v.size();
 	for (CTextList::iterator text_pit = signalList_p->begin(); text_pit != signalList_p->end(); ++text_pit) {
 		try {
-			mySignalId = localSignalIdMap.at(*text_pit);
+			mySignalId = signalIdBuildMap.at(*text_pit);
 		}
 		catch (const out_of_range& oor_exception) {
-			mySignalId = localSignalIdMap.size();
-			localSignalIdMap[*text_pit] = mySignalId;
+			mySignalId = signalIdBuildMap.size();
+			signalIdBuildMap[*text_pit] = mySignalId;
 			internalSignalList.push_back(*text_pit);
 		}
-		signalId_v.push_back(mySignalId);
+		signalIdPool_v.push_back(mySignalId);
 	}
+	signalId_v.Set(signalIdPool_v.data() + myFirstSignal, signalList_p->size());
 }
 
 deviceId_t CCircuit::GetLocalDeviceId(text_t theName) {
@@ -101,10 +104,17 @@ void CCircuit::LoadDevices(CDevicePtrList * theDevicePtrList_p) {
 		cout << "Read " << myCircuitCount << " circuits, " << myInstanceCount << " instances, " << myDeviceCount << " devices\r" << std::flush;
 		myPrintCount = 0;
 	}
+	size_t mySignalCount = 0;
+	for (CDevicePtrList::iterator device_ppit = theDevicePtrList_p->begin(); device_ppit != theDevicePtrList_p->end(); device_ppit++) {
+		mySignalCount += (*device_ppit)->signalList_p->size();
+	}
+	signalIdPool_v.reserve(mySignalCount);  // exact size. spans point into the pool
 	CTextDeviceIdMap myDeviceIdMap;  // temporary map to check for duplicate device/instance names
 	for (CDevicePtrList::iterator device_ppit = theDevicePtrList_p->begin(); device_ppit != theDevicePtrList_p->end(); device_ppit++) {
 		myDevice_p = *device_ppit;
 		SetSignalIds(myDevice_p->signalList_p, myDevice_p->signalId_v);
+		delete myDevice_p->signalList_p;  // names are only needed to assign ids
+		myDevice_p->signalList_p = NULL;
 		myDevice_p->parent_p = this;
 		if ( myDeviceIdMap.count(myDevice_p->name) ) {
 			cout << "ERROR: Duplicate instance " << myDevice_p->name << " in " << name << endl;
@@ -125,12 +135,81 @@ void CCircuit::LoadDevices(CDevicePtrList * theDevicePtrList_p) {
 		}
 	}
 	// list to vector conversion (top circuit must be redone to include top ports)
-	internalSignal_v.reserve(internalSignalList.size());
-	while( ! internalSignalList.empty() ) {
-		internalSignal_v.push_back(internalSignalList.front());
-		internalSignalList.pop_front();
+	internalSignal_v.assign(internalSignalList.begin(), internalSignalList.end());
+	CTextList().swap(internalSignalList);
+
+}
+
+void CCircuit::FreezeSignalIds() {
+	/// Called once after ports and devices are loaded. Signal ids do not change after parsing.
+	localSignalIdMap.Freeze(signalIdBuildMap);
+}
+
+inline void HashCombine(uint64_t & theHash, uint64_t theValue) {
+	theHash = ( theHash ^ theValue ) * 0x100000001b3ULL;
+}
+
+uint64_t CCircuit::StructureHash(CTextCircuitPtrMap & theCircuitNameMap) {
+	/// Hash of names, parameters and connections. Subcircuits are identified by the master they currently resolve to.
+	// Text is stored once, so text pointers identify names and parameters.
+	uint64_t myHash = portCount;
+	HashCombine(myHash, localSignalIdMap.size());
+	for ( auto signal_pit = internalSignal_v.begin(); signal_pit != internalSignal_v.end(); signal_pit++ ) {
+		HashCombine(myHash, uintptr_t(*signal_pit));
 	}
+	for ( CDevicePtrVector * myDeviceList_p : {&devicePtr_v, &subcircuitPtr_v} ) {
+		HashCombine(myHash, myDeviceList_p->size());
+		for ( auto device_ppit = myDeviceList_p->begin(); device_ppit != myDeviceList_p->end(); device_ppit++ ) {
+			HashCombine(myHash, uintptr_t((*device_ppit)->name));
+			HashCombine(myHash, uintptr_t((*device_ppit)->parameters));
+			for ( auto net_pit = (*device_ppit)->signalId_v.begin(); net_pit != (*device_ppit)->signalId_v.end(); net_pit++ ) {
+				HashCombine(myHash, *net_pit);
+			}
+		}
+	}
+	for ( auto subcircuit_ppit = subcircuitPtr_v.begin(); subcircuit_ppit != subcircuitPtr_v.end(); subcircuit_ppit++ ) {
+		auto myMaster_pit = theCircuitNameMap.find((*subcircuit_ppit)->masterName);
+		HashCombine(myHash, ( myMaster_pit == theCircuitNameMap.end() ) ? uintptr_t((*subcircuit_ppit)->masterName) : uintptr_t(myMaster_pit->second));
+	}
+	return ( myHash );
+}
+
+bool CCircuit::IsSameStructure(CCircuit * theCircuit_p, CTextCircuitPtrMap & theCircuitNameMap) {
+	/// True if this circuit and theCircuit_p differ only in circuit name.
+	if ( portCount != theCircuit_p->portCount || checksum != theCircuit_p->checksum ) return false;
+	if ( internalSignal_v != theCircuit_p->internalSignal_v || localSignalIdMap.size() != theCircuit_p->localSignalIdMap.size() ) return false;
+	for ( auto signal_pit = localSignalIdMap.begin(); signal_pit != localSignalIdMap.end(); signal_pit++ ) {  // port names
+		auto myOther_pit = theCircuit_p->localSignalIdMap.find(signal_pit->first);
+		if ( myOther_pit == theCircuit_p->localSignalIdMap.end() || myOther_pit->second != signal_pit->second ) return false;
+	}
+	if ( devicePtr_v.size() != theCircuit_p->devicePtr_v.size() || subcircuitPtr_v.size() != theCircuit_p->subcircuitPtr_v.size() ) return false;
+	for ( size_t device_it = 0; device_it < devicePtr_v.size(); device_it++ ) {
+		CDevice * myDevice_p = devicePtr_v[device_it];
+		CDevice * myOtherDevice_p = theCircuit_p->devicePtr_v[device_it];
+		if ( myDevice_p->name != myOtherDevice_p->name || myDevice_p->parameters != myOtherDevice_p->parameters
+				|| myDevice_p->signalId_v != myOtherDevice_p->signalId_v ) return false;
+	}
+	for ( size_t subcircuit_it = 0; subcircuit_it < subcircuitPtr_v.size(); subcircuit_it++ ) {
+		CDevice * mySubcircuit_p = subcircuitPtr_v[subcircuit_it];
+		CDevice * myOtherSubcircuit_p = theCircuit_p->subcircuitPtr_v[subcircuit_it];
+		if ( mySubcircuit_p->name != myOtherSubcircuit_p->name || mySubcircuit_p->signalId_v != myOtherSubcircuit_p->signalId_v ) return false;
+		if ( mySubcircuit_p->masterName != myOtherSubcircuit_p->masterName ) {
+			auto myMaster_pit = theCircuitNameMap.find(mySubcircuit_p->masterName);
+			auto myOtherMaster_pit = theCircuitNameMap.find(myOtherSubcircuit_p->masterName);
+			if ( myMaster_pit == theCircuitNameMap.end() || myOtherMaster_pit == theCircuitNameMap.end()
+					|| myMaster_pit->second != myOtherMaster_pit->second ) return false;
+		}
+	}
+	return true;
+}
 
+bool CCircuit::NameMatch(regex & theSearchPattern) {
+	/// True if the circuit name or the name of a merged circuit matches.
+	if ( regex_match(name, theSearchPattern) ) return true;
+	for ( auto alias_pit = alias_v.begin(); alias_pit != alias_v.end(); alias_pit++ ) {
+		if ( regex_match(*alias_pit, theSearchPattern) ) return true;
+	}
+	return false;
 }
 
 void CCircuit::CountObjectsAndLinkSubcircuits(unordered_map<text_t, CCircuit *> & theCircuitNameMap) {
@@ -196,7 +275,7 @@ void CCircuit::Print (const string theIndentation) {
 	string myIndentation = theIndentation + " ";
 	cout << myIndentation << "Signal List(" << portCount << "/" << localSignalIdMap.size() << "): ";
 	mySignalName_v.reserve(localSignalIdMap.size());
-	for (CTextNetIdMap::iterator textNetIdPair_pit = localSignalIdMap.begin(); textNetIdPair_pit != localSignalIdMap.end(); ++textNetIdPair_pit) {
+	for (CTextNetIdArray::iterator textNetIdPair_pit = localSignalIdMap.begin(); textNetIdPair_pit != localSignalIdMap.end(); ++textNetIdPair_pit) {
 		mySignalName_v[textNetIdPair_pit->second] = textNetIdPair_pit->first;
 	}
 	while (mySignalId < localSignalIdMap.size()) {
@@ -223,6 +302,8 @@ void CCircuitPtrList::Clear() {
 	for ( auto circuit_ppit = begin(); circuit_ppit != end(); circuit_ppit++ ) {
 		delete (*circuit_ppit);
 	}
+	clear();
+	deviceArena.Clear();
 	errorCount = 0;
 }
 
@@ -281,5 +362,12 @@ void CCircuitPtrList::PrintAndResetCircuitErrors(CCvcDb * theCvcDb_p, deviceId_t
  
 void CCircuit::AllocateInstances(CCvcDb * theCvcDb_p, instanceId_t theFirstInstanceId) {
 	instanceId_v.reserve(instanceCount);
-	instanceHashId_v.resize(instanceCount, UNKNOWN_DEVICE);
+	instanceHashId_v.clear();
+	instanceHash_v.clear();
+	if ( CheckParallelInstances(theCvcDb_p->cvcParameters.cvcParallelCircuitPortLimit) ) {  // power of 2 table at most half full
+		size_t myTableSize = 2;
+		while ( myTableSize < size_t(instanceCount) * 2 ) myTableSize <<= 1;
+		instanceHashId_v.resize(myTableSize, UNKNOWN_INSTANCE);
+		instanceHash_v.resize(myTableSize);
+	}
 }
@@ -32,27 +32,39 @@ class CCvcDb;
 #include "CFixedText.hh"
 #include "gzstream.h"
 
+class CCircuit;
+
+class CTextCircuitPtrMap : public unordered_map<text_t, CCircuit *> {
+public:
+	CTextCircuitPtrMap(float theLoadFactor = DEFAULT_LOAD_FACTOR) {max_load_factor(theLoadFactor);}
+};
+
 class CCircuit {
 	// subcircuit instance/device name to deviceID map
 	static text_t lastDeviceMap;
 	static CTextDeviceIdMap localDeviceIdMap;
 	static text_t lastSubcircuitMap;
 	static CTextDeviceIdMap localSubcircuitIdMap;
+	// local signal to local netID Map while the circuit is parsed
+	static CTextNetIdMap signalIdBuildMap;
 public:
 	deviceId_t errorLimit = UNKNOWN_DEVICE;
+	deviceId_t errorLimitId = UNKNOWN_DEVICE;  // sequence in cell error limit file
 	text_t name;
-	// local signal to local netID Map
-	CTextNetIdMap localSignalIdMap;
-	// temporary list to convert to vector
+	// local signal to local netID Map. frozen after parsing
+	CTextNetIdArray localSignalIdMap;
+	// temporary list to convert to vector. released after LoadDevices
 	CTextList	internalSignalList;
 	// local netID to signal name map
 	CTextVector	internalSignal_v;
+	CNetIdVector	signalIdPool_v;  // signal ids of all devices and subcircuits
 	CDevicePtrVector	devicePtr_v;
 	CDevicePtrVector	subcircuitPtr_v;
 	vector<array<deviceId_t, 5>>	deviceErrorCount_v;
 	vector<array<deviceId_t, 5>>	devicePrintCount_v;
 	CInstanceIdVector instanceId_v;
-	CInstanceIdVector instanceHashId_v;
+	CInstanceIdVector instanceHashId_v;  // open addressed parallel instance table. only used during global id assignment
+	vector<uint64_t> instanceHash_v;  // port signatures for instanceHashId_v
 
 	netId_t	portCount = 0;
 	// total items for this circuit and all subcircuits
@@ -63,30 +75,33 @@ public:
 	// the number of instantiations
 	instanceId_t	instanceCount = 0;
 	string	checksum = "";
+	CTextVector	alias_v;  // names of identical circuits merged into this one
 
 //	deviceId_t		errorCount = 0;
 //	deviceId_t		warningCount = 0;
 	bool	linked = false;
 
 	inline netId_t	LocalNetCount() { assert(localSignalIdMap.size() >= portCount); return ( localSignalIdMap.size() - portCount); }
+	// instances of circuits with at most thePortLimit ports are checked for parallel duplicates
+	inline bool	CheckParallelInstances(size_t thePortLimit) { return ( portCount <= thePortLimit ); }
 
 	void AddPortSignalIds(CTextList * thePortList_p);
-	void SetSignalIds(CTextList * theSignalList_p, CNetIdVector & theSignalId_v);
+	void SetSignalIds(CTextList * theSignalList_p, CNetIdSpan & theSignalId_v);
 	deviceId_t GetLocalDeviceId(text_t theName);
 	deviceId_t GetLocalSubcircuitId(text_t theName);
 	void LoadDevices(CDevicePtrList * theDeviceList_p);
+	void FreezeSignalIds();
+
+	uint64_t StructureHash(CTextCircuitPtrMap & theCircuitNameMap);
+	bool IsSameStructure(CCircuit * theCircuit_p, CTextCircuitPtrMap & theCircuitNameMap);
+	bool NameMatch(regex & theSearchPattern);
 
 	void CountObjectsAndLinkSubcircuits(unordered_map<text_t, CCircuit *> & theCircuitNameMap);
 	void CountInstantiations();
 
 	void Print(const string theIndentation = "");
 
-	void AllocateInstances(CCvcDb * theCvcDb_p, instanceId_t theFirstInstanceId);
-};
-
-class CTextCircuitPtrMap : public unordered_map<text_t, CCircuit *> {
-public:
-	CTextCircuitPtrMap(float theLoadFactor = DEFAULT_LOAD_FACTOR) {max_load_factor(theLoadFactor);}
+	void AllocateInstances(CCvcDb * theCvcDb_p, instanceId_t theFirstInstanceId);
 };
 
 static set<modelType_t> emptyModelList;
@@ -97,6 +112,7 @@ public:
 	CFixedText	cdlText;
 	CTextCircuitPtrMap  circuitNameMap;
 	CFixedText	parameterText;
+	CDeviceArena	deviceArena;
 	int			errorCount = 0;
 	int			warningCount = 0;
 //	CCircuitPtrList();
@@ -24,6 +24,17 @@
 #include "CConnection.hh"
 #include "CCvcDb.hh"
 
+void CFullConnection::ResetResolvedConnections() {
+	// clear values that may be left from a previous device before a partial resolution
+	resolvedMinTerminals = resolvedSimTerminals = resolvedMaxTerminals = 0;
+	minSourceVoltage = minDrainVoltage = minGateVoltage = minBulkVoltage = UNKNOWN_VOLTAGE;
+	simSourceVoltage = simDrainVoltage = simGateVoltage = simBulkVoltage = UNKNOWN_VOLTAGE;
+	maxSourceVoltage = maxDrainVoltage = maxGateVoltage = maxBulkVoltage = UNKNOWN_VOLTAGE;
+	minSourcePower_p = minDrainPower_p = minGatePower_p = minBulkPower_p = NULL;
+	simSourcePower_p = simDrainPower_p = simGatePower_p = simBulkPower_p = NULL;
+	maxSourcePower_p = maxDrainPower_p = maxGatePower_p = maxBulkPower_p = NULL;
+}
+
 float CFullConnection::EstimatedCurrent() {
 	voltage_t myMaxVoltage = max(simSourceVoltage, simDrainVoltage);
 	voltage_t myMinVoltage = min(simSourceVoltage, simDrainVoltage);
@@ -60,6 +60,12 @@ public:
 
 };
 
+// queues for partial CFullConnection resolution
+#define MIN_CONNECTIONS	0x1
+#define SIM_CONNECTIONS	0x2
+#define MAX_CONNECTIONS	0x4
+#define ALL_CONNECTIONS	0x7
+
 void AddConnectedDevices(netId_t theNetId, list<deviceId_t>& myPmosToCheck,	list<deviceId_t>& myNmosToCheck,
 		list<deviceId_t>& myResistorToCheck, CDeviceIdVector& theFirstDevice_v, CDeviceIdVector& theNextDevice_v, vector<modelType_t>& theDeviceType_v );
 
@@ -144,6 +150,12 @@ public:
 	deviceId_t deviceId = UNKNOWN_DEVICE;
 	resistance_t resistance = INFINITE_RESISTANCE;
 
+	// terminals (GATE|SOURCE|DRAIN|BULK) resolved for each queue. see CCvcDb::ResolveConnections
+	int resolvedMinTerminals = 0;
+	int resolvedSimTerminals = 0;
+	int resolvedMaxTerminals = 0;
+
+	void ResetResolvedConnections();
 	float EstimatedCurrent();
 	float EstimatedCurrent(bool theVthFlag);
 	float EstimatedMinimumCurrent();
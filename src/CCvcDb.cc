@@ -43,7 +43,7 @@ char RESISTOR_TEXT[] = " resistor";  // leading space to differentiate from norm
  * Note: if the propagated voltage and limited voltage differ by exactly Vth, the short is ignored. This is the expected result of mos diodes.
  */
 void CCvcDb::ReportSimShort(deviceId_t theDeviceId, voltage_t theMainVoltage, voltage_t theShortVoltage, string theCalculation) {
-	static CFullConnection myConnections;
+	CFullConnection myConnections;
 	MapDeviceNets(theDeviceId, myConnections);
 	voltage_t myMaxVoltage = max(theMainVoltage, theShortVoltage);
 	voltage_t myMinVoltage = min(theMainVoltage, theShortVoltage);
@@ -69,7 +69,7 @@ void CCvcDb::ReportSimShort(deviceId_t theDeviceId, voltage_t theMainVoltage, vo
  * Note: leaks between external power are always errors if threshold = 0.
  */
 void CCvcDb::ReportShort(deviceId_t theDeviceId) {
-	static CFullConnection myConnections;
+	CFullConnection myConnections;
 	MapDeviceNets(theDeviceId, myConnections);
 	voltage_t myMaxVoltage = max(myConnections.simSourceVoltage, myConnections.simDrainVoltage);
 	voltage_t myMinVoltage = min(myConnections.simSourceVoltage, myConnections.simDrainVoltage);
@@ -160,7 +160,7 @@ bool CCvcDb::IsPriorityDevice(CEventQueue& theEventQueue, modelType_t theModel)
 
 void CCvcDb::AlreadyShorted(CEventQueue& theEventQueue, deviceId_t theDeviceId, CConnection& theConnections) {
 	// add logic for equivalent voltage shorts.
-	static CVirtualNet myLastVirtualNet;
+	CVirtualNet myLastVirtualNet;
 	if ( theConnections.masterSourceNet.finalNetId == theConnections.masterDrainNet.finalNetId ) {
 		// no shifting on second pass causes looping. Only reroute direct connections.
 		if ( IsPriorityDevice(theEventQueue, deviceType_v[theConnections.deviceId]) ) {
@@ -392,8 +392,8 @@ bool CCvcDb::VoltageConflict(CEventQueue& theEventQueue, deviceId_t theDeviceId,
 			}
 		}
 		// Unset min checks
-		CStatus & myDrainStatus = netStatus_v[theConnections.drainId];
-		CStatus & mySourceStatus = netStatus_v[theConnections.sourceId];
+		CStatusVector::reference myDrainStatus = netStatus_v[theConnections.drainId];
+		CStatusVector::reference mySourceStatus = netStatus_v[theConnections.sourceId];
 		bool mySourceVerified = ! (mySourceStatus[NEEDS_MIN_CHECK] || mySourceStatus[NEEDS_MIN_CONNECTION]);
 		bool myDrainVerified = ! (myDrainStatus[NEEDS_MIN_CHECK] || myDrainStatus[NEEDS_MIN_CONNECTION]);
 		if ( ( myDrainStatus[NEEDS_MIN_CHECK] || myDrainStatus[NEEDS_MIN_CONNECTION] )
@@ -478,8 +478,8 @@ bool CCvcDb::VoltageConflict(CEventQueue& theEventQueue, deviceId_t theDeviceId,
 			}
 		}
 		// Unset max checks
-		CStatus & myDrainStatus = netStatus_v[theConnections.drainId];
-		CStatus & mySourceStatus = netStatus_v[theConnections.sourceId];
+		CStatusVector::reference myDrainStatus = netStatus_v[theConnections.drainId];
+		CStatusVector::reference mySourceStatus = netStatus_v[theConnections.sourceId];
 		bool mySourceVerified = ! (mySourceStatus[NEEDS_MAX_CHECK] || mySourceStatus[NEEDS_MAX_CONNECTION]);
 		bool myDrainVerified = ! (myDrainStatus[NEEDS_MAX_CHECK] || myDrainStatus[NEEDS_MAX_CONNECTION]);
 		if ( ( myDrainStatus[NEEDS_MAX_CHECK] || myDrainStatus[NEEDS_MAX_CONNECTION] )
@@ -975,7 +975,7 @@ string CCvcDb::AdjustSimVoltage(CEventQueue& theEventQueue, deviceId_t theDevice
 void CCvcDb::EnqueueAttachedDevicesByTerminal(CEventQueue& theEventQueue, netId_t theNetId, CDeviceIdVector& theFirstDevice_v, CDeviceIdVector& theNextDevice_v, eventKey_t theEventKey) {
 	// TODO: possibly remove inactive devices from connection lists
 	if ( theFirstDevice_v[theNetId] == UNKNOWN_DEVICE ) return;
-	static CConnection myConnections;
+	CConnection myConnections;
 	queuePosition_t myQueuePosition;
 	eventKey_t myEventKey;
 	string myAdjustedCalculation;
@@ -1319,7 +1319,7 @@ void CCvcDb::ShortSimNets(CEventQueue& theEventQueue, deviceId_t theDeviceId, CC
 	}
 	if ( theShortVoltage == myMasterVoltage ) {
 		if ( IsSCRCPower(myMasterPower_p) && connectionCount_v[mySlaveNet].sourceDrainType[NMOS] && connectionCount_v[mySlaveNet].sourceDrainType[PMOS] && IsMos_(deviceType_v[theDeviceId]) ) {
-			static CFullConnection myConnections;
+			CFullConnection myConnections;
 			MapDeviceNets(theDeviceId, myConnections);
 			CPower * myOppositePower_p;
 			if ( IsNmos_(deviceType_v[theDeviceId]) ) {
@@ -1374,12 +1374,13 @@ void CCvcDb::PropagateConnectionType(CVirtualNetVector& theVirtualNet_v, CStatus
 	}
 }
 
-void CCvcDb::PropagateResistorVoltages(CEventQueue& theEventQueue) {
+void CCvcDb::PropagateResistorVoltages(CPropagationContext& theContext) {
+	CEventQueue & theEventQueue = theContext.eventQueue;
 	deviceId_t myDeviceId = theEventQueue.GetEvent();
 	deviceStatus_v[myDeviceId][theEventQueue.pendingBit] = false;
 	queuePosition_t myQueuePosition;
 	if ( deviceStatus_v[myDeviceId][theEventQueue.inactiveBit] ) return;
-	static CConnection myConnections;
+	CConnection & myConnections = theContext.connections;
 	MapDeviceNets(myDeviceId, theEventQueue, myConnections);
 	if ( myConnections.IsUnknownSourceVoltage() ) {
 		assert (myConnections.drainVoltage != UNKNOWN_VOLTAGE);
@@ -1402,7 +1403,8 @@ void CCvcDb::PropagateResistorVoltages(CEventQueue& theEventQueue) {
 	}
 }
 
-void CCvcDb::PropagateMinMaxVoltages(CEventQueue& theEventQueue) {
+void CCvcDb::PropagateMinMaxVoltages(CPropagationContext& theContext) {
+	CEventQueue & theEventQueue = theContext.eventQueue;
 	eventKey_t myQueueKey = theEventQueue.QueueTime();
 	deviceId_t myDeviceId = theEventQueue.GetEvent();
 	deviceStatus_v[myDeviceId][theEventQueue.pendingBit] = false;
@@ -1411,7 +1413,7 @@ void CCvcDb::PropagateMinMaxVoltages(CEventQueue& theEventQueue) {
 	queuePosition_t myQueuePosition;
 	netId_t myDrainId, mySourceId;
 	shortDirection_t myDirection;
-	static CConnection myConnections;
+	CConnection & myConnections = theContext.connections;
 	MapDeviceNets(myDeviceId, theEventQueue, myConnections);
 	// BUG: 20140307 if both nets are known, need highest for max, lowest for min.
 	if ( myConnections.sourceVoltage != UNKNOWN_VOLTAGE ) {
@@ -1503,7 +1505,9 @@ void CCvcDb::PropagateMinMaxVoltages(CEventQueue& theEventQueue) {
 	}
 }
 
-void CCvcDb::PropagateSimVoltages(CEventQueue& theEventQueue, propagation_t thePropagationType) {
+void CCvcDb::PropagateSimVoltages(CPropagationContext& theContext) {
+	CEventQueue & theEventQueue = theContext.eventQueue;
+	propagation_t thePropagationType = theContext.propagationType;
 	eventKey_t myQueueKey = theEventQueue.QueueTime();
 	deviceId_t myDeviceId = theEventQueue.GetEvent();
 	deviceStatus_v[myDeviceId][theEventQueue.pendingBit] = false;
@@ -1511,7 +1515,7 @@ void CCvcDb::PropagateSimVoltages(CEventQueue& theEventQueue, propagation_t theP
 	voltage_t mySimVoltage;
 	netId_t myNextNetId;
 	shortDirection_t myDirection;
-	static CConnection myConnections;
+	CConnection & myConnections = theContext.connections;
 	MapDeviceNets(myDeviceId, theEventQueue, myConnections);
 	// 20140522A: when both source and drain are known, choose high for pmos, low for nmos
 	if ( myConnections.IsUnknownSourceVoltage() ) {
@@ -1630,30 +1634,55 @@ void CCvcDb::CalculateResistorVoltage(netId_t theNetId, voltage_t theMinVoltage,
 }
 
 void CCvcDb::PropagateResistorCalculations(netId_t theNetId, CDeviceIdVector& theFirstDevice_v, CDeviceIdVector& theNextDevice_v) {
-	CFullConnection myConnections;
 	for ( deviceId_t device_it = theFirstDevice_v[theNetId]; device_it != UNKNOWN_DEVICE; device_it = theNextDevice_v[device_it] ) {
 		if ( deviceType_v[device_it] == RESISTOR ) {
-			MapDeviceNets(device_it, myConnections);
-			if ( netVoltagePtr_v[myConnections.drainId].full == NULL ) {
-				cvcParameters.cvcPowerPtrList.push_back(new CPower(myConnections.drainId));
-				netVoltagePtr_v[myConnections.drainId].full = cvcParameters.cvcPowerPtrList.back();
-				netVoltagePtr_v[myConnections.drainId].full->type[RESISTOR_BIT] = true;
-				netVoltagePtr_v[myConnections.drainId].full->extraData = new CExtraPowerData;
-				netVoltagePtr_v[myConnections.drainId].full->extraData->powerSignal = CPower::powerDefinitionText.SetTextAddress(RESISTOR_TEXT);
+			netId_t myDrainId = drainNet_v[device_it];  // only the nets are needed, so no full mapping
+			netId_t mySourceId = sourceNet_v[device_it];
+			if ( netVoltagePtr_v[myDrainId].full == NULL ) {
+				cvcParameters.cvcPowerPtrList.push_back(new CPower(myDrainId));
+				netVoltagePtr_v[myDrainId].full = cvcParameters.cvcPowerPtrList.back();
+				netVoltagePtr_v[myDrainId].full->type[RESISTOR_BIT] = true;
+				netVoltagePtr_v[myDrainId].full->extraData = new CExtraPowerData;
+				netVoltagePtr_v[myDrainId].full->extraData->powerSignal = CPower::powerDefinitionText.SetTextAddress(RESISTOR_TEXT);
 			}
-			if ( netVoltagePtr_v[myConnections.sourceId].full == NULL ) {
-				cvcParameters.cvcPowerPtrList.push_back(new CPower(myConnections.sourceId));
-				netVoltagePtr_v[myConnections.sourceId].full = cvcParameters.cvcPowerPtrList.back();
-				netVoltagePtr_v[myConnections.sourceId].full->type[RESISTOR_BIT] = true;
-				netVoltagePtr_v[myConnections.sourceId].full->extraData = new CExtraPowerData;
-				netVoltagePtr_v[myConnections.sourceId].full->extraData->powerSignal = CPower::powerDefinitionText.SetTextAddress(RESISTOR_TEXT);
+			if ( netVoltagePtr_v[mySourceId].full == NULL ) {
+				cvcParameters.cvcPowerPtrList.push_back(new CPower(mySourceId));
+				netVoltagePtr_v[mySourceId].full = cvcParameters.cvcPowerPtrList.back();
+				netVoltagePtr_v[mySourceId].full->type[RESISTOR_BIT] = true;
+				netVoltagePtr_v[mySourceId].full->extraData = new CExtraPowerData;
+				netVoltagePtr_v[mySourceId].full->extraData->powerSignal = CPower::powerDefinitionText.SetTextAddress(RESISTOR_TEXT);
 			}
 		}
 	}
 }
 
+bool CCvcDb::IsResistorCalculationNet(netId_t theNetId) {
+	/// True for undefined resistor only nets and resistor nets without calculated voltages
+	CPower * myPower_p = netVoltagePtr_v[theNetId].full;
+	if ( myPower_p == NULL ) return ( connectionCount_v[theNetId].sourceDrainType == RESISTOR_ONLY );
+	return ( myPower_p->type[RESISTOR_BIT] && myPower_p->simVoltage == UNKNOWN_VOLTAGE );
+}
+
+void CCvcDb::CollectResistorNets(CNetIdVector& theNet_v) {
+	/// Lists the nets of active resistors that may need voltage calculations, once each in device order.
+	/// Voltages are calculated per net, so nets shared by several resistors are listed once.
+	theNet_v.clear();
+	CBitVector myListed_v(netCount);
+	deviceId_t myResistorCount = 0;
+	for (deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
+		if ( deviceType_v[device_it] != RESISTOR || deviceStatus_v[device_it][SIM_INACTIVE] ) continue;
+		myResistorCount++;
+		netId_t myNet_v[2] = { sourceNet_v[device_it], drainNet_v[device_it] };
+		for ( int net_it = 0; net_it < 2; net_it++ ) {
+			if ( myListed_v[myNet_v[net_it]] || ! IsResistorCalculationNet(myNet_v[net_it]) ) continue;
+			myListed_v[myNet_v[net_it]] = true;
+			theNet_v.push_back(myNet_v[net_it]);
+		}
+	}
+	logFile << "Resistor nets to calculate: " << theNet_v.size() << " from " << myResistorCount << " resistors" << endl;
+}
+
 void CCvcDb::CalculateResistorVoltages() {
-	CFullConnection myConnections;
 	calculatedResistanceInfo_v.clear();
 	for (auto power_ppit = cvcParameters.cvcPowerPtrList.begin(); power_ppit != cvcParameters.cvcPowerPtrList.end(); power_ppit++) {
 		// since new entries are appended to the power list, this routine is effectively recursive
@@ -1665,24 +1694,18 @@ void CCvcDb::CalculateResistorVoltages() {
 			}
 		}
 	}
-	for (deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
-		if ( deviceType_v[device_it] == RESISTOR && deviceStatus_v[device_it][SIM_INACTIVE] == false ) {
-			MapDeviceNets(device_it, myConnections);
-			if ( ( netVoltagePtr_v[myConnections.sourceId].full == NULL && connectionCount_v[myConnections.sourceId].sourceDrainType == RESISTOR_ONLY ) ||
-					( netVoltagePtr_v[myConnections.sourceId].full && netVoltagePtr_v[myConnections.sourceId].full->type[RESISTOR_BIT] && netVoltagePtr_v[myConnections.sourceId].full->simVoltage == UNKNOWN_VOLTAGE ) ) {
-				if ( myConnections.minSourceVoltage != myConnections.maxSourceVoltage ) {
-					CalculateResistorVoltage(myConnections.sourceId, myConnections.minSourceVoltage, myConnections.masterMinSourceNet.finalResistance,
-							myConnections.maxSourceVoltage, myConnections.masterMaxSourceNet.finalResistance);
-
-				}
-			}
-			if ( ( netVoltagePtr_v[myConnections.drainId].full == NULL && connectionCount_v[myConnections.drainId].sourceDrainType == RESISTOR_ONLY ) ||
-					( netVoltagePtr_v[myConnections.drainId].full && netVoltagePtr_v[myConnections.drainId].full->type[RESISTOR_BIT] && netVoltagePtr_v[myConnections.drainId].full->simVoltage == UNKNOWN_VOLTAGE  ) ) {
-				if ( myConnections.minDrainVoltage != myConnections.maxDrainVoltage ) {
-					CalculateResistorVoltage(myConnections.drainId, myConnections.minDrainVoltage, myConnections.masterMinDrainNet.finalResistance,
-							myConnections.maxDrainVoltage, myConnections.masterMaxDrainNet.finalResistance);
-				}
-			}
+	// calculations only add power to the calculated net, so each net can be checked once
+	CNetIdVector myResistorNet_v;
+	CollectResistorNets(myResistorNet_v);
+	CVirtualNet myMinNet;
+	CVirtualNet myMaxNet;
+	for ( auto net_pit = myResistorNet_v.begin(); net_pit != myResistorNet_v.end(); net_pit++ ) {
+		myMinNet(minNet_v, *net_pit);
+		myMaxNet(maxNet_v, *net_pit);
+		voltage_t myMinVoltage = netVoltagePtr_v.MinVoltage(myMinNet.finalNetId);
+		voltage_t myMaxVoltage = netVoltagePtr_v.MaxVoltage(myMaxNet.finalNetId);
+		if ( myMinVoltage != myMaxVoltage ) {
+			CalculateResistorVoltage(*net_pit, myMinVoltage, myMinNet.finalResistance, myMaxVoltage, myMaxNet.finalResistance);
 		}
 	}
 	netId_t myLastPowerNet;
@@ -1734,11 +1757,13 @@ void CCvcDb::SetResistorVoltagesByPower() {
 	}
 	minEventQueue.queueStart = true;
 	maxEventQueue.queueStart = true;
+	CPropagationContext myMinContext(minEventQueue);
+	CPropagationContext myMaxContext(maxEventQueue);
 	while (minEventQueue.QueueSize() + maxEventQueue.QueueSize() > 0) {
 		if (minEventQueue.QueueSize() > maxEventQueue.QueueSize()) {
-			PropagateResistorVoltages(minEventQueue);
+			PropagateResistorVoltages(myMinContext);
 		} else {
-			PropagateResistorVoltages(maxEventQueue);
+			PropagateResistorVoltages(myMaxContext);
 		}
 	}
 	CalculateResistorVoltages();
@@ -1954,6 +1979,8 @@ void CCvcDb::SetInitialMinMaxPower() {
 	}
 	minEventQueue.queueStart = true;
 	maxEventQueue.queueStart = true;
+	CPropagationContext myMinContext(minEventQueue);
+	CPropagationContext myMaxContext(maxEventQueue);
 	long myLoopCount = minEventQueue.QueueSize() + maxEventQueue.QueueSize();
 	long myDequeueCount = 0;
 	bool myProcessingMinQueue = false;
@@ -1978,9 +2005,9 @@ void CCvcDb::SetInitialMinMaxPower() {
 		}
 		assert(myDequeueCount);
 		if ( myProcessingMinQueue ) {
-			PropagateMinMaxVoltages(minEventQueue);
+			PropagateMinMaxVoltages(myMinContext);
 		} else {
-			PropagateMinMaxVoltages(maxEventQueue);
+			PropagateMinMaxVoltages(myMaxContext);
 		}
 		myDequeueCount --;
 		myLoopCount --;
@@ -2035,8 +2062,8 @@ void CCvcDb::SetInitialMinMaxPower() {
 	// really slow. has to calculate #device*#terminal instead of #net
 	size_t myIgnoreCount = 0;
 	CFullConnection myConnections;
-	for ( deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
-		if ( deviceStatus_v[device_it][SIM_INACTIVE] ) continue;
+	for ( deviceId_t device_it = deviceStatus_v.FindNext(SIM_INACTIVE, 0, false); device_it < deviceCount;
+			device_it = deviceStatus_v.FindNext(SIM_INACTIVE, device_it + 1, false) ) {
 		MapDeviceSourceDrainNets(device_it, myConnections);
 		bool myIsHiZDrain = ( myConnections.minDrainPower_p && myConnections.minDrainPower_p->type[HIZ_BIT] ) ||
 				( myConnections.maxDrainPower_p && myConnections.maxDrainPower_p->type[HIZ_BIT] );
@@ -2054,8 +2081,8 @@ void CCvcDb::SetInitialMinMaxPower() {
 
 void CCvcDb::IgnoreUnusedDevices() {
 	CFullConnection myConnections;
-	for ( deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
-		if ( deviceStatus_v[device_it][SIM_INACTIVE] ) continue;
+	for ( deviceId_t device_it = deviceStatus_v.FindNext(SIM_INACTIVE, 0, false); device_it < deviceCount;
+			device_it = deviceStatus_v.FindNext(SIM_INACTIVE, device_it + 1, false) ) {
 		MapDeviceNets(device_it, myConnections);
 		if ( myConnections.minSourceVoltage == UNKNOWN_VOLTAGE || myConnections.minDrainVoltage == UNKNOWN_VOLTAGE ||
 				myConnections.maxSourceVoltage == UNKNOWN_VOLTAGE || myConnections.maxDrainVoltage == UNKNOWN_VOLTAGE ) {
@@ -2070,9 +2097,8 @@ void CCvcDb::ResetMinMaxPower() {
 	maxEventQueue.ResetQueue(deviceCount);
 	minNet_v.InitializeUpdateArray();
 	maxNet_v.InitializeUpdateArray();
-	for (deviceId_t device_it = 0; device_it < deviceCount; device_it++) {
-		deviceStatus_v[device_it][MIN_INACTIVE] = deviceStatus_v[device_it][MAX_INACTIVE] = deviceStatus_v[device_it][SIM_INACTIVE];
-	}
+	deviceStatus_v.CopyBit(SIM_INACTIVE, MIN_INACTIVE);
+	deviceStatus_v.CopyBit(SIM_INACTIVE, MAX_INACTIVE);
 	CPower * myVoltage_p;
 	for (netId_t net_it = 0; net_it < netCount; net_it++) {
 		if ( isFixedSimNet ) { // after first sim pass
@@ -2280,11 +2306,17 @@ void CCvcDb::SetSimPower(propagation_t thePropagationType, CNetIdSet & theNewNet
 	simNet_v.InitializeUpdateArray();
 	isFixedSimNet = false;
 	CVirtualNet mySimMasterNet;
-	for (netId_t net_it = 0; net_it < netCount; net_it++) {
+	CNetIdVector mySeedNet_v;
+	if ( theNewNetSet.size() > 0 ) {  // only seed new nets, in net order for reproducible event order
+		mySeedNet_v.assign(theNewNetSet.begin(), theNewNetSet.end());
+		sort(mySeedNet_v.begin(), mySeedNet_v.end());
+	}
+	netId_t mySeedCount = ( theNewNetSet.size() > 0 ) ? mySeedNet_v.size() : netCount;
+	for (netId_t seed_it = 0; seed_it < mySeedCount; seed_it++) {
+		netId_t net_it = ( theNewNetSet.size() > 0 ) ? mySeedNet_v[seed_it] : seed_it;
 		if ( net_it != GetEquivalentNet(net_it) ) continue; // skip subordinate nets
 		// TODO: Change to GetMasterNet
 		mySimMasterNet(simNet_v, net_it);
-		if ( theNewNetSet.size() > 0 && theNewNetSet.count(net_it) == 0 ) continue;  // not relavant to this pass
 		if ( netVoltagePtr_v[mySimMasterNet.finalNetId].full == NULL ) continue;
 		CPower * myPower_p = netVoltagePtr_v[mySimMasterNet.finalNetId].full;
 		if ( myPower_p->simVoltage == UNKNOWN_VOLTAGE && ! IsSCRCPower(myPower_p) ) continue;
@@ -2294,8 +2326,9 @@ void CCvcDb::SetSimPower(propagation_t thePropagationType, CNetIdSet & theNewNet
 		EnqueueAttachedDevicesByTerminal(simEventQueue, net_it, firstGate_v, nextGate_v, myPower_p->simVoltage);
 	}
 	simEventQueue.queueStart = true;
+	CPropagationContext mySimContext(simEventQueue, thePropagationType);
 	while (simEventQueue.QueueSize() > 0) {
-		PropagateSimVoltages(simEventQueue, thePropagationType);
+		PropagateSimVoltages(mySimContext);
 	}
 	for ( netId_t net_it = 0; net_it < netCount; net_it++ ) {
 		simNet_v[net_it](simNet_v, net_it); // recalculate final values
@@ -2305,9 +2338,9 @@ void CCvcDb::SetSimPower(propagation_t thePropagationType, CNetIdSet & theNewNet
 }
 
 void CCvcDb::CheckConnections() {
-	static CVirtualNet myVirtualNet;
-	static CVirtualNet myMinNet;
-	static CVirtualNet myMaxNet;
+	CVirtualNet myVirtualNet;
+	CVirtualNet myMinNet;
+	CVirtualNet myMaxNet;
 	unordered_map<netId_t, pair<deviceId_t, deviceId_t>> myBulkCount;
 	for (deviceId_t device_it = 0; device_it < deviceCount; device_it++) {
 		if ( bulkNet_v[device_it] == UNKNOWN_NET ) continue;
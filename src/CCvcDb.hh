@@ -37,6 +37,7 @@ class CCvcDb;
 #include "CConnectionCount.hh"
 #include "CConnection.hh"
 #include "CDependencyMap.hh"
+#include "CCdlWriter.hh"
 #include "gzstream.h"
 
 extern char RESISTOR_TEXT[];
@@ -51,6 +52,18 @@ public:
 	CNetMap(float theLoadFactor = DEFAULT_LOAD_FACTOR) {max_load_factor(theLoadFactor);}
 };
 
+// Working state for propagating one event queue.
+// Each propagation owns its context, so queues do not share scratch connections.
+class CPropagationContext {
+public:
+	CEventQueue &	eventQueue;
+	propagation_t	propagationType;  // only used for sim propagation
+	CConnection	connections;  // device taken from the queue
+
+	CPropagationContext(CEventQueue & theEventQueue, propagation_t thePropagationType = ALL_NETS_AND_FUSE)
+		: eventQueue(theEventQueue), propagationType(thePropagationType) {}
+};
+
 class CCvcDb {
 public:
 	int	cvcArgIndex = 1;
@@ -68,8 +81,8 @@ public:
 
 	// parent instance.	 Use offset from first in instance to find name, etc.
 	// [*] = instance
-	CInstanceIdVector	netParent_v;
-	CInstanceIdVector	deviceParent_v;
+	CParentIndex	netParent_v;
+	CParentIndex	deviceParent_v;
 
 	// [device] = device
 	CDeviceIdVector	nextSource_v;
@@ -132,8 +145,6 @@ public:
 	uintmax_t	subcircuitCount;
 	uintmax_t	netCount;
 
-	unsigned int	lineLength = 0;
-
 	CTextResistanceMap	parameterResistanceMap;
 
 	voltage_t	minPower = MAX_VOLTAGE;
@@ -146,7 +157,8 @@ public:
 
 	map<netId_t, string> calculatedResistanceInfo_v;
 
-	unordered_map<string, deviceId_t> cellErrorCountMap;
+	unordered_map<uint64_t, deviceId_t> cellErrorCountMap;  // key from CellErrorKey_
+	CBitVector	errorSuppressedInstance_v;  // instances in cells with error limit 0
 
 	forward_list<string> inverterInputOutputCheckList;  // list of nets to check for matched input/output
 	forward_list<pair<string, string>> oppositeLogicList;  // list of nets to check for opposite logic
@@ -175,11 +187,16 @@ public:
 	void CountObjectsAndLinkSubcircuits();
 
 	void AssignGlobalIDs();
+	void PrintParentIndex(string theName, CParentIndex & theIndex);
 	void ResetMinSimMaxAndQueues();
 	CPower * SetMasterPower(netId_t theFirstNet, netId_t theSecondNet, bool & theSamePowerFlag);
 	netId_t MasterPowerNet(netId_t theFirstNetId, netId_t theSecondNetId);
 	void MakeEquivalentNets(CNetMap & theNetMap, netId_t theFirstNetId, netId_t theSecondNetId, deviceId_t theDeviceId);
 	void SetEquivalentNets();
+	void MergeParallelFingers(CCircuit * theCircuit_p);
+	void MergeIdenticalCircuits();
+	void MergeIdenticalCircuits(CCircuit * theCircuit_p, vector<regex *> & theCellFilter_v, unordered_map<uint64_t, list<CCircuit *>> & theStructureMap,
+		unordered_set<CCircuit *> & theVisitedCircuits, list<CCircuit *> & theMergedCircuits);
 	void LinkDevices();
 	returnCode_t SetDeviceModels();
 	void DumpConnectionList(string theHeading, CDeviceIdVector& theFirstDevice_v, CDeviceIdVector& theNextDevice_v);
@@ -211,7 +228,7 @@ public:
 	void SetSCRCParentPower(netId_t theNetId, deviceId_t theDeviceId, bool theExpectedHighInput, size_t & theSCRCSignalCount, size_t & theSCRCIgnoreCount);
 	bool IsSCRCLogicNet(netId_t theNetId);
 	bool IsSCRCPower(CPower * thePower_p);
-	bool SetLatchPower(int thePassCount, vector<bool> & theIgnoreNet_v, CNetIdSet & theNewNetSet);
+	bool SetLatchPower(int thePassCount, CBitVector & theIgnoreNet_v, CNetIdSet & theNewNetSet);
 	void FindLatchDevices(netId_t theNetId, mosData_t theNmosData_v[], mosData_t thePmosData_v[], int & theNmosCount, int & thePmosCount,
 		voltage_t theMinVoltage, voltage_t theMaxVoltage,
 		CDeviceIdVector & theFirstDrain_v, CDeviceIdVector & theNextDrain_v, CNetIdVector & theSourceNet_v);
@@ -234,15 +251,20 @@ public:
 	void FindModelError(ogzstream & theErrorFile, CModelCheck &theCheck, CFullConnection & theConnections, instanceId_t theInstanceId);
 	void PrintOverVoltageError(ogzstream & theErrorFile, CFullConnection & theConnections, cvcError_t theErrorIndex, string theExplanation, instanceId_t theInstance_p);
 	void PrintModelError(ogzstream & theErrorFile, CFullConnection & theConnections, CModelCheck & theCheck, instanceId_t theInstanceId);
+	void SetOvervoltageBounds(vector<voltage_t> & theLowVoltage_v, vector<voltage_t> & theHighVoltage_v);
 	void FindAllOverVoltageErrors();
 	void AppendErrorFile(string theTempFileName, string theHeading, int theErrorSubIndex);
-	void FindNmosGateVsSourceErrors();
-	void FindPmosGateVsSourceErrors();
-	void FindNmosSourceVsBulkErrors();
-	void FindPmosSourceVsBulkErrors();
+	void CopyErrorFile(string theTempFileName);
+	void FindMosBiasAndGateErrors();
+	void CheckNmosSourceVsBulk(CFullConnection & theConnections, ogzstream & theErrorFile, unordered_set<netId_t> & theProblemNets);
+	void CheckNmosGateVsSource(CFullConnection & theConnections, ogzstream & theErrorFile);
+	void CheckPmosSourceVsBulk(CFullConnection & theConnections, ogzstream & theErrorFile, unordered_set<netId_t> & theProblemNets);
+	void CheckPmosGateVsSource(CFullConnection & theConnections, ogzstream & theErrorFile, bool theSuppressErrorFlag = false);
+	void PrintBiasProblemNets(unordered_set<netId_t> & theProblemNets, string theMosType);
 	void FindForwardBiasDiodes();
-	void FindNmosPossibleLeakErrors();
-	void FindPmosPossibleLeakErrors();
+	void FindMosPossibleLeakErrors();
+	void CheckNmosPossibleLeak(CFullConnection & theConnections, ogzstream & theErrorFile);
+	void CheckPmosPossibleLeak(CFullConnection & theConnections, ogzstream & theErrorFile);
 	void FindFloatingInputErrors();
 	void CheckExpectedValues();
 	void FindLDDErrors();
@@ -272,7 +294,7 @@ public:
 	bool IsOffMos(eventQueue_t theQueueType, deviceId_t theDeviceId, CConnection& theConnections, voltage_t theVoltage);
 	void EnqueueAttachedDevicesByTerminal(CEventQueue& theEventQueue, netId_t theNetId, CDeviceIdVector& theFirstDevice_v, CDeviceIdVector& theNextDevice_v, eventKey_t theEventKey);
 	void EnqueueAttachedDevices(CEventQueue& theEventQueue, netId_t theNetId, eventKey_t theEventKey);
-	void PropagateMinMaxVoltages(CEventQueue& theEventQueue);
+	void PropagateMinMaxVoltages(CPropagationContext& theContext);
 	bool CheckEstimateDependency(CDependencyMap& theDependencyMap, size_t theEstimateType, list<netId_t>& theDependencyList);
 	void CheckEstimateDependencies();
 	void SetTrivialMinMaxPower();
@@ -290,12 +312,14 @@ public:
 	void ShortNets(CEventQueue& theEventQueue, deviceId_t theDeviceId, CConnection& theConnections, shortDirection_t theDirection);
 	void ShortNets(CEventQueue& theEventQueue, deviceId_t theDeviceId, CConnection& theConnections, shortDirection_t theDirection, voltage_t theVoltage, string theCalculation);
 	void ShortSimNets(CEventQueue& theEventQueue, deviceId_t theDeviceId, CConnection& theConnections, shortDirection_t theDirection, voltage_t theVoltage, string theCalculation);
-	void PropagateResistorVoltages(CEventQueue& theEventQueue);
+	void PropagateResistorVoltages(CPropagationContext& theContext);
 	void PropagateConnectionType(CVirtualNetVector& theVirtualNet_v, CStatus theSourceDrainType, netId_t theNetId);
-	void PropagateSimVoltages(CEventQueue& theEventQueue, propagation_t thePropagationType);
+	void PropagateSimVoltages(CPropagationContext& theContext);
 	void CalculateResistorVoltage(netId_t theNetId, voltage_t theMinVoltage, resistance_t theMinResistance,
 			voltage_t theMaxVoltage, resistance_t theMaxResistance );
 	void PropagateResistorCalculations(netId_t theNetId, CDeviceIdVector& theFirstDevice_v, CDeviceIdVector& theNextDevice_v);
+	bool IsResistorCalculationNet(netId_t theNetId);
+	void CollectResistorNets(CNetIdVector& theNet_v);
 	void CalculateResistorVoltages();
 	void SetResistorVoltagesByPower();
 	void ResetMinMaxPower();
@@ -334,9 +358,11 @@ public:
 	void SetDeviceNets(CInstance * theInstance_p, CDevice * theDevice_p, netId_t& theSourceId, netId_t& theGateId, netId_t& theDrainId, netId_t& theBulkId);
 	void SetDeviceNets(deviceId_t theDeviceId, CDevice * theDevice_p, netId_t& theSourceId, netId_t& theGateId, netId_t& theDrainId, netId_t& theBulkId);
 	void MapDeviceNets(deviceId_t theDeviceId, CEventQueue& theEventQueue, CConnection& theConnections);
-	void MapDeviceNets(deviceId_t theDeviceId, CFullConnection& theConnections);
+	void MapDeviceNets(deviceId_t theDeviceId, CFullConnection& theConnections, int theTerminals = GSDB, int theQueues = ALL_CONNECTIONS);
 	void MapDeviceSourceDrainNets(deviceId_t theDeviceId, CFullConnection& theConnections);
-	void MapDeviceNets(CInstance * theInstance_p, CDevice * theDevice_p, CFullConnection& theConnections);
+	void MapDeviceNets(CInstance * theInstance_p, CDevice * theDevice_p, CFullConnection& theConnections, int theTerminals = GSDB, int theQueues = ALL_CONNECTIONS);
+	void ResolveConnections(CFullConnection& theConnections, int theTerminals = GSDB, int theQueues = ALL_CONNECTIONS);
+	void ResolveTerminal(CVirtualNetVector& theVirtualNet_v, eventQueue_t theQueue, netId_t theNetId, CVirtualNet& theMasterNet, voltage_t& theVoltage, CPower * & thePower_p);
 
 	void IgnoreDevice(deviceId_t theDeviceId);
 	bool EqualMasterNets(CVirtualNetVector& theVirtualNet_v, netId_t theFirstNetId, netId_t theSecondNetId);
@@ -348,12 +374,16 @@ public:
 	voltage_t DefaultMinVoltage(CPower * thePower_p);
 	voltage_t DefaultMaxVoltage(CPower * thePower_p);
 	bool HasLeakPath(CFullConnection& theConnections);
+	bool HasParallelShort(CFullConnection & theConnections, unordered_map<uint64_t, bool> theParallelShortMap[2]);
 	void RestoreQueue(CEventQueue& theBaseEventQueue, CEventQueue& theSavedEventQueue, deviceStatus_t theStatusBit);
 	void CheckConnections();
 	bool PathContains(CVirtualNetVector& theSearchVector, netId_t theSearchNet, netId_t theTargetNet);
 	bool PathCrosses(CVirtualNetVector& theSearchVector, netId_t theSearchNet, CVirtualNetVector& theTargetVector, netId_t theTargetNet);
 	bool HasActiveConnection(netId_t theNet);
 	size_t IncrementDeviceError(deviceId_t theDeviceId, int theErrorIndex);
+	inline bool IsErrorSuppressed(deviceId_t theDeviceId) {
+		return ( errorSuppressedInstance_v.size() > 0 && errorSuppressedInstance_v[deviceParent_v[theDeviceId]] );
+	}
 	eventKey_t SimKey(eventKey_t theCurrentKey, resistance_t theIncrement);
 	bool IsDerivedFromFloating(CVirtualNetVector& theVirtualNet_v, netId_t theNetId);
 	bool HasActiveConnections(netId_t theNetId);
@@ -394,17 +424,13 @@ public:
 
 	void PrintEquivalentNets(string theIndentation);
 	void PrintInverterNets(string theIndentation);
-	void PrintFlatCdl();
-	void PrintHierarchicalCdl(CCircuit *theCircuit, unordered_set<text_t> & thePrintedList, ostream & theCdlFile);
-	void PrintNewCdlLine(const string theData, ostream & theOutput = cout);
-	void PrintNewCdlLine(const text_t theData, ostream & theOutput = cout);
-	void PrintNewCdlLine(const char theData, ostream & theOutput = cout);
+	const string & CdlHierarchyPrefix(instanceId_t theInstanceId, vector<pair<instanceId_t, string>> & thePrefixCache);
+	returnCode_t PrintFlatCdl(string theFileName = "");
+	void PrintHierarchicalCdl(CCircuit *theCircuit, unordered_set<CCircuit *> & thePrintedList, CCdlWriter & theWriter);
 	void PrintSourceDrainConnections(CStatus& theConnectionStatus, string theIndentation);
 	void PrintConnections(deviceId_t theDeviceCount, deviceId_t theDeviceId, CDeviceIdVector& theNextDeviceId_v, string theIndentation = "", string theHeading = "Connections>");
 	void PrintBulkConnections(netId_t theNetId, string theIndentation, string theHeading);
 
-	void PrintCdlLine(const string theData, ostream & theOutput = cout, const unsigned int theMaxLength = 80);
-	void PrintCdlLine(const char * theData, ostream & theOutput = cout, const unsigned int theMaxLength = 80);
 	string StatusString(const CStatus& theStatus);
 
 	void Print(const string theIndentation = "", const string theHeading = "CVC Database");
@@ -545,6 +571,12 @@ void CCvcDb::PrintAllVirtualNets(TVirtualNetVector& theMinNet_v, CVirtualNetVect
 		theConnections.bulkId = bulkNet_v[theDeviceId]\
 		)
 
+#define FloatingPathKey_(theFirstNet, theSecondNet) ( uint64_t(theFirstNet) << 32 | uint64_t(theSecondNet) )
+
+// limited cell id, device id in the first instance of the parent circuit, error sub index
+#define CellErrorKey_(theLimitId, theDeviceId, theSubIndex) \
+	( ( ( uint64_t(theLimitId) << 32 | uint64_t(theDeviceId) ) << 3 ) | uint64_t(theSubIndex) )
+
 #define ExceedsLeakLimit_(theLeakCurrent) (rint(((theLeakCurrent) - cvcParameters.cvcLeakLimit) * 1e9) / 1e9 > 0)
 
 #endif /* CCVCDB_HH_ */
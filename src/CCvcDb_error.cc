@@ -36,6 +36,9 @@
 
 #include <stdio.h>
 
+extern set<modelType_t> NMOS_MODELS;
+extern set<modelType_t> PMOS_MODELS;
+
 void CCvcDb::PrintFuseError(netId_t theTargetNetId, CConnection & theConnections) {
 	if ( IncrementDeviceError(theConnections.deviceId, FUSE_ERROR) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
 		CFullConnection myFullConnections;
@@ -262,6 +265,35 @@ static std::string GetTemporaryFileName() {
 	return myFileName;
 }
 
+void CCvcDb::SetOvervoltageBounds(vector<voltage_t> & theLowVoltage_v, vector<voltage_t> & theHighVoltage_v) {
+	/// Lowest and highest voltage possible on each net (min, max and leak), used to screen overvoltage candidates.
+	/// Nets without known voltages have empty ranges (low > high). Leak checks also compare single voltages to 0.
+	voltage_t myEmptyLow = cvcParameters.cvcLeakOvervoltage ? 0 : INT16_MAX;
+	voltage_t myEmptyHigh = cvcParameters.cvcLeakOvervoltage ? 0 : INT16_MIN;
+	theLowVoltage_v.assign(netCount, myEmptyLow);
+	theHighVoltage_v.assign(netCount, myEmptyHigh);
+	CVirtualNet myNet;
+	voltage_t myVoltage[4];
+	for ( netId_t net_it = 0; net_it < netCount; net_it++ ) {
+		if ( GetEquivalentNet(net_it) != net_it ) continue;  // device terminals only use master nets
+		myNet(minNet_v, net_it);
+		myVoltage[0] = netVoltagePtr_v.MinVoltage(myNet.finalNetId);
+		myNet(maxNet_v, net_it);
+		myVoltage[1] = netVoltagePtr_v.MaxVoltage(myNet.finalNetId);
+		myVoltage[2] = cvcParameters.cvcLeakOvervoltage ? MinLeakVoltage(net_it) : UNKNOWN_VOLTAGE;
+		myVoltage[3] = cvcParameters.cvcLeakOvervoltage ? MaxLeakVoltage(net_it) : UNKNOWN_VOLTAGE;
+		for ( int voltage_it = 0; voltage_it < 4; voltage_it++ ) {
+			if ( myVoltage[voltage_it] == UNKNOWN_VOLTAGE ) continue;
+			theLowVoltage_v[net_it] = min(theLowVoltage_v[net_it], myVoltage[voltage_it]);
+			theHighVoltage_v[net_it] = max(theHighVoltage_v[net_it], myVoltage[voltage_it]);
+		}
+	}
+}
+
+// Largest possible |a - b| for a in [theFirstLow, theFirstHigh] and b in [theSecondLow, theSecondHigh].
+#define MaxVoltageSpread_(theFirstLow, theFirstHigh, theSecondLow, theSecondHigh) \
+	max((int) (theFirstHigh) - (int) (theSecondLow), (int) (theSecondHigh) - (int) (theFirstLow))
+
 void CCvcDb::FindAllOverVoltageErrors() {
 	CFullConnection myConnections;
 	reportFile << "! Checking overvoltage errors" << endl << endl;
@@ -281,6 +313,14 @@ void CCvcDb::FindAllOverVoltageErrors() {
 	ogzstream myModelErrorFile(myModelErrorFileName);
 	myModelErrorFile << "! Checking Model errors" << endl << endl;
 
+	// Devices are screened in batches using per net voltage bounds. Only possible violators are fully mapped.
+	vector<voltage_t> myLowVoltage_v, myHighVoltage_v;
+	SetOvervoltageBounds(myLowVoltage_v, myHighVoltage_v);
+	voltage_t myEmptyLow = cvcParameters.cvcLeakOvervoltage ? 0 : INT16_MAX;
+	voltage_t myEmptyHigh = cvcParameters.cvcLeakOvervoltage ? 0 : INT16_MIN;
+	vector<instanceId_t> myInstanceId_v;
+	vector<voltage_t> myTerminalLow_v[4], myTerminalHigh_v[4];  // gate, source, drain, bulk
+	vector<char> myCandidate_v, mySuppressed_v;
 	for (CModelListMap::iterator keyModelListPair_pit = cvcParameters.cvcModelListMap.begin(); keyModelListPair_pit != cvcParameters.cvcModelListMap.end(); keyModelListPair_pit++) {
 		for (CModelList::iterator model_pit = keyModelListPair_pit->second.begin(); model_pit != keyModelListPair_pit->second.end(); model_pit++) {
 			if ( model_pit->maxVbg == UNKNOWN_VOLTAGE && model_pit->maxVbs == UNKNOWN_VOLTAGE
@@ -299,11 +339,53 @@ void CCvcDb::FindAllOverVoltageErrors() {
 			if ( model_pit->maxVgs != UNKNOWN_VOLTAGE ) {
 				myVgsDisplayParameter = " Vgs=" + PrintToleranceParameter(model_pit->maxVgsDefinition, model_pit->maxVgs, VOLTAGE_SCALE) + " " + model_pit->ConditionString();
 			}
+			// same thresholds as FindV*Error. unchecked parameters never match.
+			int myVbgLimit = ( model_pit->maxVbg == UNKNOWN_VOLTAGE ) ? INT_MAX : (voltage_t) (model_pit->maxVbg + cvcParameters.cvcOvervoltageErrorThreshold);
+			int myVbsLimit = ( model_pit->maxVbs == UNKNOWN_VOLTAGE ) ? INT_MAX : (voltage_t) (model_pit->maxVbs + cvcParameters.cvcOvervoltageErrorThreshold);
+			int myVdsLimit = ( model_pit->maxVds == UNKNOWN_VOLTAGE ) ? INT_MAX : (voltage_t) (model_pit->maxVds + cvcParameters.cvcOvervoltageErrorThreshold);
+			int myVgsLimit = ( model_pit->maxVgs == UNKNOWN_VOLTAGE ) ? INT_MAX : (voltage_t) (model_pit->maxVgs + cvcParameters.cvcOvervoltageErrorThreshold);
+			bool myCheckAll = ! model_pit->checkList.empty();  // model checks are not screened
 			while (myDevice_p) {
 				CCircuit * myParent_p = myDevice_p->parent_p;
-				for (instanceId_t instance_it = 0; instance_it < myParent_p->instanceId_v.size(); instance_it++) {
+				myInstanceId_v.clear();
+				for (instanceId_t instance_it = 0; instance_it < myParent_p->instanceId_v.size() && myDevice_p->fingerCount > 0; instance_it++) {  // merged fingers are checked with the first finger
 					if  ( instancePtr_v[myParent_p->instanceId_v[instance_it]]->IsParallelInstance() ) continue;  // parallel/empty instances
-					instanceId_t myInstanceId = myParent_p->instanceId_v[instance_it];
+					myInstanceId_v.push_back(myParent_p->instanceId_v[instance_it]);
+				}
+				size_t myInstanceCount = myInstanceId_v.size();
+				for ( int terminal_it = 0; terminal_it < 4; terminal_it++ ) {
+					myTerminalLow_v[terminal_it].resize(myInstanceCount);
+					myTerminalHigh_v[terminal_it].resize(myInstanceCount);
+				}
+				mySuppressed_v.resize(myInstanceCount);
+				for ( size_t index = 0; index < myInstanceCount; index++ ) {
+					deviceId_t myDeviceId = instancePtr_v[myInstanceId_v[index]]->firstDeviceId + myDevice_p->offset;
+					mySuppressed_v[index] = IsErrorSuppressed(myDeviceId);
+					netId_t myNetId[4] = { gateNet_v[myDeviceId], sourceNet_v[myDeviceId], drainNet_v[myDeviceId], bulkNet_v[myDeviceId] };
+					for ( int terminal_it = 0; terminal_it < 4; terminal_it++ ) {
+						bool myIsUnknown = ( myNetId[terminal_it] == UNKNOWN_NET );
+						myTerminalLow_v[terminal_it][index] = myIsUnknown ? myEmptyLow : myLowVoltage_v[myNetId[terminal_it]];
+						myTerminalHigh_v[terminal_it][index] = myIsUnknown ? myEmptyHigh : myHighVoltage_v[myNetId[terminal_it]];
+					}
+				}
+				myCandidate_v.resize(myInstanceCount);
+				voltage_t * myGateLow = myTerminalLow_v[0].data(), * myGateHigh = myTerminalHigh_v[0].data();
+				voltage_t * mySourceLow = myTerminalLow_v[1].data(), * mySourceHigh = myTerminalHigh_v[1].data();
+				voltage_t * myDrainLow = myTerminalLow_v[2].data(), * myDrainHigh = myTerminalHigh_v[2].data();
+				voltage_t * myBulkLow = myTerminalLow_v[3].data(), * myBulkHigh = myTerminalHigh_v[3].data();
+				for ( size_t index = 0; index < myInstanceCount; index++ ) {  // branch free so the compiler can vectorize
+					myCandidate_v[index] = ( myCheckAll
+						| ( MaxVoltageSpread_(myGateLow[index], myGateHigh[index], myBulkLow[index], myBulkHigh[index]) > myVbgLimit )
+						| ( MaxVoltageSpread_(mySourceLow[index], mySourceHigh[index], myBulkLow[index], myBulkHigh[index]) > myVbsLimit )
+						| ( MaxVoltageSpread_(myDrainLow[index], myDrainHigh[index], myBulkLow[index], myBulkHigh[index]) > myVbsLimit )
+						| ( MaxVoltageSpread_(mySourceLow[index], mySourceHigh[index], myDrainLow[index], myDrainHigh[index]) > myVdsLimit )
+						| ( MaxVoltageSpread_(myGateLow[index], myGateHigh[index], mySourceLow[index], mySourceHigh[index]) > myVgsLimit )
+						| ( MaxVoltageSpread_(myGateLow[index], myGateHigh[index], myDrainLow[index], myDrainHigh[index]) > myVgsLimit ) )
+						& ! mySuppressed_v[index];
+				}
+				for ( size_t index = 0; index < myInstanceCount; index++ ) {
+					if ( ! myCandidate_v[index] ) continue;
+					instanceId_t myInstanceId = myInstanceId_v[index];
 					CInstance * myInstance_p = instancePtr_v[myInstanceId];
 					MapDeviceNets(myInstance_p, myDevice_p, myConnections);
 					myConnections.SetMinMaxLeakVoltagesAndFlags(this);
@@ -333,477 +415,486 @@ void CCvcDb::FindAllOverVoltageErrors() {
 }
 
 void CCvcDb::AppendErrorFile(string theTempFileName, string theHeading, int theErrorSubIndex) {
+	CopyErrorFile(theTempFileName);
+	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, theHeading, theErrorSubIndex);
+}
+
+void CCvcDb::CopyErrorFile(string theTempFileName) {
 	igzstream myTempFile(theTempFileName);
 	errorFile << myTempFile.rdbuf();
-	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, theHeading, theErrorSubIndex);
 	myTempFile.close();
 	remove(theTempFileName.c_str());
 }
  
-void CCvcDb::FindNmosGateVsSourceErrors() {
+void CCvcDb::FindMosBiasAndGateErrors() {
+	// Stage 4 source/drain vs bias and gate vs source checks share one pass over the devices.
+	// Each check writes to its own temporary file so that the error file sections keep their order.
+	bool myCheckBias = ! cvcParameters.cvcSOI;
+	bool myCheckGate = ! gSetup_cvc;
+	if ( ! myCheckBias && ! myCheckGate ) return;
 	CFullConnection myConnections;
-	reportFile << "! Checking nmos gate vs source errors: " << endl << endl;
-	errorFile << "! Checking nmos gate vs source errors: " << endl << endl;
+	string myNmosBiasErrorFileName(GetTemporaryFileName());
+	ogzstream myNmosBiasErrorFile(myNmosBiasErrorFileName);
+	myNmosBiasErrorFile << "! Checking nmos source/drain vs bias errors: " << endl << endl;
+	string myNmosGateErrorFileName(GetTemporaryFileName());
+	ogzstream myNmosGateErrorFile(myNmosGateErrorFileName);
+	myNmosGateErrorFile << "! Checking nmos gate vs source errors: " << endl << endl;
+	string myPmosBiasErrorFileName(GetTemporaryFileName());
+	ogzstream myPmosBiasErrorFile(myPmosBiasErrorFileName);
+	myPmosBiasErrorFile << "! Checking pmos source/drain vs bias errors: " << endl << endl;
+	string myPmosGateErrorFileName(GetTemporaryFileName());
+	ogzstream myPmosGateErrorFile(myPmosGateErrorFileName);
+	myPmosGateErrorFile << "! Checking pmos gate vs source errors: " << endl << endl;
+	unordered_set<netId_t> myNmosProblemNets;
+	unordered_set<netId_t> myPmosProblemNets;
 	for ( deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
-		CInstance * myInstance_p = instancePtr_v[deviceParent_v[device_it]];
-		CCircuit * myParent_p = myInstance_p->master_p;
-		CDevice * myDevice_p = myParent_p->devicePtr_v[device_it - myInstance_p->firstDeviceId];
-		if ( ! IsNmos_(myDevice_p->model_p->type) ) continue;
-		MapDeviceNets(myInstance_p, myDevice_p, myConnections);
-		bool myVthFlag = false;
-		bool myUnrelatedFlag = false;
-		if ( ! myConnections.minGatePower_p ) continue;
-		if ( myConnections.minGatePower_p->type[ANALOG_BIT] && ! cvcParameters.cvcAnalogGates ) continue;  // ignore analog gate errors
-		if ( IsSCRCPower(myConnections.minGatePower_p) ) continue;  // ignore SCRC input (if not logically ok, should yield floating error)
-		if ( myConnections.minGatePower_p->IsRelatedPower(myConnections.minSourcePower_p, netVoltagePtr_v, minNet_v, minNet_v, true, true)
-				&& myConnections.minGatePower_p->IsRelatedPower(myConnections.minDrainPower_p, netVoltagePtr_v, minNet_v, minNet_v, true, true) ) {
-			// if relatives (default), then checks are conditional
-			voltage_t myGateSourceDifference = myConnections.minGateVoltage - min(myConnections.minSourceVoltage, myConnections.minSourceVoltage + myDevice_p->model_p->Vth);
-			voltage_t myGateDrainDifference = myConnections.minGateVoltage - min(myConnections.minDrainVoltage, myConnections.minDrainVoltage + myDevice_p->model_p->Vth);
-			voltage_t myMaxVoltageDifference = min(0, myDevice_p->model_p->Vth);
-			if ( myConnections.CheckTerminalMinVoltages(GATE | SOURCE)
-					&& myGateSourceDifference > myMaxVoltageDifference
-					&& myConnections.gateId != myConnections.drainId ) {
-				myMaxVoltageDifference = myGateSourceDifference;
-			}
-			if ( myConnections.CheckTerminalMinVoltages(GATE | DRAIN)
-					&& myGateDrainDifference > myMaxVoltageDifference
-					&& myConnections.gateId != myConnections.sourceId ) {
-				myMaxVoltageDifference = myGateDrainDifference;
+		bool mySuppressed = ! gSetup_cvc && IsErrorSuppressed(device_it);  // setup still collects bias problem nets
+		// suppressed pmos still queue gate logic expected values, which are reported without cell limits
+		if ( mySuppressed && ! ( myCheckGate && cvcParameters.cvcLogicDiodes && IsPmos_(deviceType_v[device_it]) ) ) continue;
+		if ( IsNmos_(deviceType_v[device_it]) ) {
+			MapDeviceNets(device_it, myConnections);
+			if ( myCheckBias ) CheckNmosSourceVsBulk(myConnections, myNmosBiasErrorFile, myNmosProblemNets);
+			if ( myCheckGate ) CheckNmosGateVsSource(myConnections, myNmosGateErrorFile);
+		} else if ( IsPmos_(deviceType_v[device_it]) ) {
+			MapDeviceNets(device_it, myConnections);
+			if ( myCheckBias && ! mySuppressed ) CheckPmosSourceVsBulk(myConnections, myPmosBiasErrorFile, myPmosProblemNets);
+			if ( myCheckGate ) CheckPmosGateVsSource(myConnections, myPmosGateErrorFile, mySuppressed);
+		}
+	}
+	myNmosBiasErrorFile.close();
+	myNmosGateErrorFile.close();
+	myPmosBiasErrorFile.close();
+	myPmosGateErrorFile.close();
+	if ( myCheckBias ) {
+		reportFile << "! Checking nmos source/drain vs bias errors: " << endl << endl;
+		CopyErrorFile(myNmosBiasErrorFileName);
+		if ( gSetup_cvc ) {
+			PrintBiasProblemNets(myNmosProblemNets, "nmos");
+		} else {
+			cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking nmos source/drain vs bias errors: ",
+				SOURCE_BULK_ERROR_SUBINDEX, NMOS_MODELS);
+		}
+	} else {
+		remove(myNmosBiasErrorFileName.c_str());
+	}
+	if ( myCheckGate ) {
+		reportFile << "! Checking nmos gate vs source errors: " << endl << endl;
+		CopyErrorFile(myNmosGateErrorFileName);
+		CheckInverterIO(NMOS);
+		CheckOppositeLogic(NMOS);
+		cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking nmos gate vs source errors: ", 0, NMOS_MODELS);
+	} else {
+		remove(myNmosGateErrorFileName.c_str());
+	}
+	if ( myCheckBias ) {
+		reportFile << "! Checking pmos source/drain vs bias errors: " << endl << endl;
+		CopyErrorFile(myPmosBiasErrorFileName);
+		if ( gSetup_cvc ) {
+			PrintBiasProblemNets(myPmosProblemNets, "pmos");
+		} else {
+			cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking pmos source/drain vs bias errors: ",
+				SOURCE_BULK_ERROR_SUBINDEX, PMOS_MODELS);
+		}
+	} else {
+		remove(myPmosBiasErrorFileName.c_str());
+	}
+	if ( myCheckGate ) {
+		reportFile << "! Checking pmos gate vs source errors: " << endl << endl;
+		CopyErrorFile(myPmosGateErrorFileName);
+		CheckInverterIO(PMOS);
+		CheckOppositeLogic(PMOS);
+		cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking pmos gate vs source errors: ", 0, PMOS_MODELS);
+	} else {
+		remove(myPmosGateErrorFileName.c_str());
+	}
+}
+
+void CCvcDb::CheckNmosSourceVsBulk(CFullConnection & theConnections, ogzstream & theErrorFile, unordered_set<netId_t> & theProblemNets) {
+	if ( theConnections.sourceId == theConnections.drainId && theConnections.sourceId == theConnections.bulkId ) return;  // ignore drain = source = bulk
+	bool myErrorFlag = false;
+	bool myUnrelatedFlag = false;
+	bool mySourceError = false;
+	bool myDrainError = false;
+	if ( ! theConnections.minBulkPower_p
+			|| (theConnections.minBulkPower_p->IsRelatedPower(theConnections.minSourcePower_p, netVoltagePtr_v, minNet_v, minNet_v, true, true)
+				&& theConnections.minBulkPower_p->IsRelatedPower(theConnections.minDrainPower_p, netVoltagePtr_v, minNet_v, minNet_v, true, true)) ) {
+		// if relatives (default), then checks are conditional
+		if ( (theConnections.maxBulkVoltage == theConnections.minSourceVoltage || theConnections.minSourceVoltage == UNKNOWN_VOLTAGE)
+				&& (theConnections.maxBulkVoltage == theConnections.minDrainVoltage || theConnections.minDrainVoltage == UNKNOWN_VOLTAGE) ) return;
+			// no error if max bulk = min source = min drain
+		if ( theConnections.minBulkPower_p && theConnections.minBulkPower_p->type[HIZ_BIT] ) {
+			if ( theConnections.sourceId == theConnections.bulkId && theConnections.drainId == theConnections.bulkId ) return;
+			if ( theConnections.minSourcePower_p && ! theConnections.minBulkPower_p->IsRelatedPower(theConnections.minSourcePower_p, netVoltagePtr_v, minNet_v, minNet_v, false) ) {
+				myErrorFlag = true;
+			} else if ( theConnections.simSourcePower_p && IsKnownVoltage_(theConnections.simSourcePower_p->simVoltage)
+					&& ! theConnections.minBulkPower_p->IsRelatedPower(theConnections.simSourcePower_p, netVoltagePtr_v, minNet_v, simNet_v, false)
+					&& theConnections.simSourceVoltage < theConnections.maxBulkVoltage ) {
+				myErrorFlag = true;
+			} else if ( theConnections.maxSourcePower_p && ! theConnections.minBulkPower_p->IsRelatedPower(theConnections.maxSourcePower_p, netVoltagePtr_v, minNet_v, maxNet_v, false) ) {
+				myErrorFlag = true;
+			} else if ( theConnections.minDrainPower_p && ! theConnections.minBulkPower_p->IsRelatedPower(theConnections.minDrainPower_p, netVoltagePtr_v, minNet_v, minNet_v, false) ) {
+				myErrorFlag = true;
+			} else if ( theConnections.simDrainPower_p && IsKnownVoltage_(theConnections.simDrainPower_p->simVoltage)
+					&& ! theConnections.minBulkPower_p->IsRelatedPower(theConnections.simDrainPower_p, netVoltagePtr_v, minNet_v, simNet_v, false)
+					&& theConnections.simDrainVoltage < theConnections.maxBulkVoltage ) {
+				myErrorFlag = true;
+			} else if ( theConnections.maxDrainPower_p && ! theConnections.minBulkPower_p->IsRelatedPower(theConnections.maxDrainPower_p, netVoltagePtr_v, minNet_v, maxNet_v, false) ) {
+				myErrorFlag = true;
 			}
-			if ( myMaxVoltageDifference <= cvcParameters.cvcGateErrorThreshold
-					|| ( cvcParameters.cvcMinVthGates && myMaxVoltageDifference < myDevice_p->model_p->Vth ) ) continue;  // no error
-			// Skip gates that are always fully on
-			if ( myConnections.CheckTerminalMaxVoltages(SOURCE) ) {
-				if ( myConnections.CheckTerminalMaxVoltages(DRAIN) ) {
-					if ( myConnections.minGateVoltage >= max(myConnections.maxSourceVoltage, myConnections.maxDrainVoltage) - cvcParameters.cvcGateErrorThreshold ) continue;
-					if ( myConnections.sourceId == myConnections.drainId ) {  // capacitor check
-						if ( IsPower_(netVoltagePtr_v[myConnections.gateId].full) && IsPower_(netVoltagePtr_v[myConnections.drainId].full) ) continue;  // ignore direct power capacitors
-						if ( ! IsInputOrPower_(netVoltagePtr_v[myConnections.masterMinSourceNet.finalNetId].full)
-								|| ! IsInputOrPower_(netVoltagePtr_v[myConnections.masterMinGateNet.finalNetId].full) ) continue;  // ignore capacitors connected to non-input/power nets
-					}
-				} else {
-					if ( myConnections.minGateVoltage >= myConnections.maxSourceVoltage - cvcParameters.cvcGateErrorThreshold ) continue;
-				}
-			} else if ( myConnections.CheckTerminalMaxVoltages(DRAIN) ) {
-				if ( myConnections.minGateVoltage >= myConnections.maxDrainVoltage - cvcParameters.cvcGateErrorThreshold ) continue;
-			} else {
-				continue;  // ignore devices with no max connections
+		} else if ( theConnections.CheckTerminalMinVoltages(BULK) == false ) {
+			if ( theConnections.minSourcePower_p || theConnections.simSourcePower_p || theConnections.maxSourcePower_p ||
+					theConnections.minDrainPower_p || theConnections.simDrainPower_p || theConnections.maxDrainPower_p ) { // has some connection (all connections open -> no error)
+				myErrorFlag = true;
 			}
-			myVthFlag = myConnections.minGatePower_p->type[MIN_CALCULATED_BIT]
-				&& ( myConnections.minGateVoltage - myConnections.minSourceVoltage == myDevice_p->model_p->Vth
-					|| myConnections.minGateVoltage - myConnections.minDrainVoltage == myDevice_p->model_p->Vth );
-			if ( myVthFlag && ! cvcParameters.cvcVthGates ) continue;
-		} else {
-			myUnrelatedFlag = true;  // if not relatives, always an error
+		} else if ( theConnections.CheckTerminalMinVoltages(BULK | SOURCE) &&
+				( theConnections.minBulkVoltage - theConnections.minSourceVoltage > cvcParameters.cvcBiasErrorThreshold ||
+					( theConnections.minSourceVoltage == theConnections.minBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.masterMinSourceNet.finalResistance < theConnections.masterMinBulkNet.finalResistance) ) ) {
+			mySourceError = true;
+		} else if (	theConnections.CheckTerminalMinVoltages(BULK | DRAIN) &&
+				( theConnections.minBulkVoltage - theConnections.minDrainVoltage > cvcParameters.cvcBiasErrorThreshold ||
+					( theConnections.minDrainVoltage == theConnections.minBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.masterMinDrainNet.finalResistance < theConnections.masterMinBulkNet.finalResistance) ) ) {
+			myDrainError = true;
+		} else if (	theConnections.CheckTerminalSimVoltages(BULK | SOURCE) &&
+				( theConnections.simBulkVoltage - theConnections.simSourceVoltage > cvcParameters.cvcBiasErrorThreshold ||
+					( theConnections.simSourceVoltage == theConnections.simBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.masterSimSourceNet.finalResistance < theConnections.masterSimBulkNet.finalResistance) ) ) {
+			myErrorFlag = true;
+		} else if (	theConnections.CheckTerminalSimVoltages(BULK | DRAIN) &&
+				( theConnections.simBulkVoltage - theConnections.simDrainVoltage > cvcParameters.cvcBiasErrorThreshold ||
+					( theConnections.simDrainVoltage == theConnections.simBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.masterSimDrainNet.finalResistance < theConnections.masterSimBulkNet.finalResistance) ) ) {
+			myErrorFlag = true;
+		} else if (	theConnections.CheckTerminalMaxVoltages(BULK | SOURCE) &&
+				( ( theConnections.maxBulkVoltage - theConnections.maxSourceVoltage > cvcParameters.cvcBiasErrorThreshold &&
+						theConnections.maxSourcePower_p->defaultMaxNet != theConnections.bulkId ) ||
+					( theConnections.maxSourceVoltage == theConnections.maxBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.maxSourceVoltage != theConnections.minBulkVoltage && // no leak path
+	//						theConnections.masterMinBulkNet.finalNetId != theConnections.masterMaxBulkNet.finalNetId &&
+						theConnections.masterMaxSourceNet.finalResistance > theConnections.masterMaxBulkNet.finalResistance &&
+						! theConnections.minBulkPower_p->type[HIZ_BIT] &&
+						! PathContains(maxNet_v, theConnections.sourceId, theConnections.bulkId)) ) ) { // resistance check backwards in NMOS max (ignore connections through self)
+			myErrorFlag = true;
+	// Added 20140523
+		} else if (	theConnections.CheckTerminalMaxVoltages(BULK | DRAIN) &&
+				( ( theConnections.maxBulkVoltage - theConnections.maxDrainVoltage > cvcParameters.cvcBiasErrorThreshold &&
+						theConnections.maxDrainPower_p->defaultMaxNet != theConnections.bulkId ) ||
+					( theConnections.maxDrainVoltage == theConnections.maxBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.maxDrainVoltage != theConnections.minBulkVoltage && // no leak path
+	//						theConnections.masterMinBulkNet.finalNetId != theConnections.masterMaxBulkNet.finalNetId &&
+						theConnections.masterMaxDrainNet.finalResistance > theConnections.masterMaxBulkNet.finalResistance &&
+						! theConnections.minBulkPower_p->type[HIZ_BIT] &&
+						! PathContains(maxNet_v, theConnections.drainId, theConnections.bulkId)) ) ) { // resistance check backwards in NMOS max (ignore connections through self)
+			myErrorFlag = true;
 		}
-		if ( IncrementDeviceError(myConnections.deviceId, NMOS_GATE_SOURCE) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
+	} else {
+		myErrorFlag = true; // if not relatives, always an error
+		myUnrelatedFlag = true;
+	}
+	if ( gSetup_cvc ) {
+		if ( myDrainError ) {
+			theProblemNets.insert(theConnections.drainId);
+		} else if ( mySourceError ) {
+			theProblemNets.insert(theConnections.sourceId);
+		}
+	} else if ( myErrorFlag || myDrainError || mySourceError ) {
+		if ( IncrementDeviceError(theConnections.deviceId, NMOS_SOURCE_BULK) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
 			if ( myUnrelatedFlag ) {
-				errorFile << "Unrelated power error" << endl;
-/*
-			} else if ( myConnections.minGatePower_p->type[REFERENCE_BIT] ) {
-				errorFile << "Gate reference signal" << endl;
-*/
-			} else if ( myVthFlag ) {
-				errorFile << "Gate-source = Vth" << endl;
+				theErrorFile << "Unrelated power error" << endl;
 			}
-			PrintDeviceWithAllConnections(deviceParent_v[device_it], myConnections, errorFile);
-			errorFile << endl;
+			PrintDeviceWithAllConnections(deviceParent_v[theConnections.deviceId], theConnections, theErrorFile);
+			theErrorFile << endl;
 		}
 	}
-	CheckInverterIO(NMOS);
-	CheckOppositeLogic(NMOS);
-	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking nmos gate vs source errors: ");
 }
-char GATE_LOGIC_CHECK[] = "GateVsSource logic check";
 
-void CCvcDb::FindPmosGateVsSourceErrors() {
-	CFullConnection myConnections;
-	reportFile << "! Checking pmos gate vs source errors: " << endl << endl;
-	errorFile << "! Checking pmos gate vs source errors: " << endl << endl;
-	for ( deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
-		CInstance * myInstance_p = instancePtr_v[deviceParent_v[device_it]];
-		CCircuit * myParent_p = myInstance_p->master_p;
-		CDevice * myDevice_p = myParent_p->devicePtr_v[device_it - myInstance_p->firstDeviceId];
-		if ( ! IsPmos_(myDevice_p->model_p->type) ) continue;
-		MapDeviceNets(myInstance_p, myDevice_p, myConnections);
-		bool myVthFlag = false;
-		bool myUnrelatedFlag = false;
-		if ( ! myConnections.maxGatePower_p ) continue;
-		if ( myConnections.maxGatePower_p->type[ANALOG_BIT] && ! cvcParameters.cvcAnalogGates ) continue;  // ignore analog gate errors
-		if ( IsSCRCPower(myConnections.maxGatePower_p) ) continue;  // ignore SCRC input (if not logically ok, should yield floating error)
-		if ( myConnections.maxGatePower_p->IsRelatedPower(myConnections.maxSourcePower_p, netVoltagePtr_v, maxNet_v, maxNet_v, true, true)
-				&& myConnections.maxGatePower_p->IsRelatedPower(myConnections.maxDrainPower_p, netVoltagePtr_v, maxNet_v, maxNet_v, true, true) ) {
-			// if relatives (default), then checks are conditional
-			voltage_t myGateSourceDifference = max(myConnections.maxSourceVoltage, myConnections.maxSourceVoltage + myDevice_p->model_p->Vth) - myConnections.maxGateVoltage;
-			voltage_t myGateDrainDifference = max(myConnections.maxDrainVoltage, myConnections.maxDrainVoltage + myDevice_p->model_p->Vth) - myConnections.maxGateVoltage;
-			voltage_t myMaxVoltageDifference = max(0, myDevice_p->model_p->Vth);
-			if ( myConnections.CheckTerminalMaxVoltages(GATE | SOURCE) &&
-					myGateSourceDifference > myMaxVoltageDifference  &&
-					myConnections.gateId != myConnections.drainId ) {
-				myMaxVoltageDifference = myGateSourceDifference;
-			}
-			if ( myConnections.CheckTerminalMaxVoltages(GATE | DRAIN) &&
-					myGateDrainDifference > myMaxVoltageDifference  &&
-					myConnections.gateId != myConnections.sourceId ) {
-				myMaxVoltageDifference = myGateDrainDifference;
-			}
-			if ( myMaxVoltageDifference <= cvcParameters.cvcGateErrorThreshold
-					|| ( cvcParameters.cvcMinVthGates && myMaxVoltageDifference < -myDevice_p->model_p->Vth ) ) continue;  // no error
-			// Skip gates that are always fully on
-			if ( myConnections.CheckTerminalMinVoltages(SOURCE) ) {
-				if ( myConnections.CheckTerminalMinVoltages(DRAIN) ) {
-					if ( myConnections.maxGateVoltage <= min(myConnections.minSourceVoltage, myConnections.minDrainVoltage) + cvcParameters.cvcGateErrorThreshold ) continue;
-					if ( myConnections.sourceId == myConnections.drainId ) {  // capacitor check
-						if ( IsPower_(netVoltagePtr_v[myConnections.gateId].full) && IsPower_(netVoltagePtr_v[myConnections.drainId].full) ) continue;  // ignore direct power capacitors
-						if ( ! IsInputOrPower_(netVoltagePtr_v[myConnections.masterMinSourceNet.finalNetId].full)
-								|| ! IsInputOrPower_(netVoltagePtr_v[myConnections.masterMinGateNet.finalNetId].full) ) continue;  // ignore capacitors connected to non-input/power nets
-					}
-				} else {
-					if ( myConnections.maxGateVoltage <= myConnections.minSourceVoltage + cvcParameters.cvcGateErrorThreshold ) continue;
+void CCvcDb::CheckNmosGateVsSource(CFullConnection & theConnections, ogzstream & theErrorFile) {
+	CDevice * myDevice_p = theConnections.device_p;
+	bool myVthFlag = false;
+	bool myUnrelatedFlag = false;
+	if ( ! theConnections.minGatePower_p ) return;
+	if ( theConnections.minGatePower_p->type[ANALOG_BIT] && ! cvcParameters.cvcAnalogGates ) return;  // ignore analog gate errors
+	if ( IsSCRCPower(theConnections.minGatePower_p) ) return;  // ignore SCRC input (if not logically ok, should yield floating error)
+	if ( theConnections.minGatePower_p->IsRelatedPower(theConnections.minSourcePower_p, netVoltagePtr_v, minNet_v, minNet_v, true, true)
+			&& theConnections.minGatePower_p->IsRelatedPower(theConnections.minDrainPower_p, netVoltagePtr_v, minNet_v, minNet_v, true, true) ) {
+		// if relatives (default), then checks are conditional
+		voltage_t myGateSourceDifference = theConnections.minGateVoltage - min(theConnections.minSourceVoltage, theConnections.minSourceVoltage + myDevice_p->model_p->Vth);
+		voltage_t myGateDrainDifference = theConnections.minGateVoltage - min(theConnections.minDrainVoltage, theConnections.minDrainVoltage + myDevice_p->model_p->Vth);
+		voltage_t myMaxVoltageDifference = min(0, myDevice_p->model_p->Vth);
+		if ( theConnections.CheckTerminalMinVoltages(GATE | SOURCE)
+				&& myGateSourceDifference > myMaxVoltageDifference
+				&& theConnections.gateId != theConnections.drainId ) {
+			myMaxVoltageDifference = myGateSourceDifference;
+		}
+		if ( theConnections.CheckTerminalMinVoltages(GATE | DRAIN)
+				&& myGateDrainDifference > myMaxVoltageDifference
+				&& theConnections.gateId != theConnections.sourceId ) {
+			myMaxVoltageDifference = myGateDrainDifference;
+		}
+		if ( myMaxVoltageDifference <= cvcParameters.cvcGateErrorThreshold
+				|| ( cvcParameters.cvcMinVthGates && myMaxVoltageDifference < myDevice_p->model_p->Vth ) ) return;  // no error
+		// Skip gates that are always fully on
+		if ( theConnections.CheckTerminalMaxVoltages(SOURCE) ) {
+			if ( theConnections.CheckTerminalMaxVoltages(DRAIN) ) {
+				if ( theConnections.minGateVoltage >= max(theConnections.maxSourceVoltage, theConnections.maxDrainVoltage) - cvcParameters.cvcGateErrorThreshold ) return;
+				if ( theConnections.sourceId == theConnections.drainId ) {  // capacitor check
+					if ( IsPower_(netVoltagePtr_v[theConnections.gateId].full) && IsPower_(netVoltagePtr_v[theConnections.drainId].full) ) return;  // ignore direct power capacitors
+					if ( ! IsInputOrPower_(netVoltagePtr_v[theConnections.masterMinSourceNet.finalNetId].full)
+							|| ! IsInputOrPower_(netVoltagePtr_v[theConnections.masterMinGateNet.finalNetId].full) ) return;  // ignore capacitors connected to non-input/power nets
 				}
-			} else if ( myConnections.CheckTerminalMinVoltages(DRAIN) ) {
-				if ( myConnections.maxGateVoltage <= myConnections.minDrainVoltage + cvcParameters.cvcGateErrorThreshold ) continue;
 			} else {
-				continue;  // ignore devices with no min connections
+				if ( theConnections.minGateVoltage >= theConnections.maxSourceVoltage - cvcParameters.cvcGateErrorThreshold ) return;
 			}
-			myVthFlag= myConnections.maxGatePower_p->type[MAX_CALCULATED_BIT]
-				&& ( myConnections.maxGateVoltage - myConnections.maxSourceVoltage == myDevice_p->model_p->Vth
-					|| myConnections.maxGateVoltage - myConnections.maxDrainVoltage == myDevice_p->model_p->Vth );
-			if ( myVthFlag && ! cvcParameters.cvcVthGates ) continue;
+		} else if ( theConnections.CheckTerminalMaxVoltages(DRAIN) ) {
+			if ( theConnections.minGateVoltage >= theConnections.maxDrainVoltage - cvcParameters.cvcGateErrorThreshold ) return;
 		} else {
-			myUnrelatedFlag = true; // if not relatives, always an error
-		}
-		if ( myConnections.maxGatePower_p->type[MAX_CALCULATED_BIT] && cvcParameters.cvcLogicDiodes && ! netVoltagePtr_v[myConnections.gateId].full ) {
-			// If the source is a calculated value and the CVC_LOGIC_DIODE switch is on and there is no current definition,
-			// there is no error if the gate logic value is low (WARNING: set to 0V is just a kludge)
-			// check expected value later
-			debugFile << "EXPECT low for GateVsSource: " << NetName(myConnections.gateId) << " at " << DeviceName(myConnections.deviceId, PRINT_CIRCUIT_ON) << endl;
-			CPower * myPower_p = new CPower(myConnections.gateId);
-			myPower_p->definition = CPower::powerDefinitionText.SetTextAddress(GATE_LOGIC_CHECK);
-			myPower_p->extraData = new CExtraPowerData;
-			myPower_p->minVoltage = UNKNOWN_VOLTAGE;
-			myPower_p->simVoltage = UNKNOWN_VOLTAGE;
-			myPower_p->maxVoltage = UNKNOWN_VOLTAGE;
-			myPower_p->type[INPUT_BIT] = false;
-			myPower_p->extraData->expectedSim = "0";
-			cvcParameters.cvcExpectedLevelPtrList.push_back(myPower_p);
-			continue;  // Don't flag error here
+			return;  // ignore devices with no max connections
 		}
-		if ( IncrementDeviceError(myConnections.deviceId, PMOS_GATE_SOURCE) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
-			if ( myUnrelatedFlag ) {
-				errorFile << "Unrelated power error" << endl;
+		myVthFlag = theConnections.minGatePower_p->type[MIN_CALCULATED_BIT]
+			&& ( theConnections.minGateVoltage - theConnections.minSourceVoltage == myDevice_p->model_p->Vth
+				|| theConnections.minGateVoltage - theConnections.minDrainVoltage == myDevice_p->model_p->Vth );
+		if ( myVthFlag && ! cvcParameters.cvcVthGates ) return;
+	} else {
+		myUnrelatedFlag = true;  // if not relatives, always an error
+	}
+	if ( IncrementDeviceError(theConnections.deviceId, NMOS_GATE_SOURCE) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
+		if ( myUnrelatedFlag ) {
+			theErrorFile << "Unrelated power error" << endl;
 /*
-			} else if ( myConnections.maxGatePower_p->type[REFERENCE_BIT] ) {
-				errorFile << "Gate reference signal" << endl;
+		} else if ( theConnections.minGatePower_p->type[REFERENCE_BIT] ) {
+			theErrorFile << "Gate reference signal" << endl;
 */
-			} else if ( myVthFlag ) {
-				errorFile << "Gate-source = Vth" << endl;
-			}
-			PrintDeviceWithAllConnections(deviceParent_v[device_it], myConnections, errorFile);
-			errorFile << endl;
+		} else if ( myVthFlag ) {
+			theErrorFile << "Gate-source = Vth" << endl;
 		}
+		PrintDeviceWithAllConnections(deviceParent_v[theConnections.deviceId], theConnections, theErrorFile);
+		theErrorFile << endl;
 	}
-	CheckInverterIO(PMOS);
-	CheckOppositeLogic(PMOS);
-	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking pmos gate vs source errors: ");
 }
 
-void CCvcDb::FindNmosSourceVsBulkErrors() {
-	CFullConnection myConnections;
-	reportFile << "! Checking nmos source/drain vs bias errors: " << endl << endl;
-	errorFile << "! Checking nmos source/drain vs bias errors: " << endl << endl;
-	unordered_set<netId_t> myProblemNets;
-	for ( deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
-		CInstance * myInstance_p = instancePtr_v[deviceParent_v[device_it]];
-		CCircuit * myParent_p = myInstance_p->master_p;
-		CDevice * myDevice_p = myParent_p->devicePtr_v[device_it - myInstance_p->firstDeviceId];
-		if ( ! IsNmos_(myDevice_p->model_p->type) ) continue;
-		MapDeviceNets(myInstance_p, myDevice_p, myConnections);
-		if ( myConnections.sourceId == myConnections.drainId && myConnections.sourceId == myConnections.bulkId ) continue;  // ignore drain = source = bulk
-		bool myErrorFlag = false;
-		bool myUnrelatedFlag = false;
-		bool mySourceError = false;
-		bool myDrainError = false;
-		if ( ! myConnections.minBulkPower_p
-				|| (myConnections.minBulkPower_p->IsRelatedPower(myConnections.minSourcePower_p, netVoltagePtr_v, minNet_v, minNet_v, true, true)
-					&& myConnections.minBulkPower_p->IsRelatedPower(myConnections.minDrainPower_p, netVoltagePtr_v, minNet_v, minNet_v, true, true)) ) {
-			// if relatives (default), then checks are conditional
-			if ( (myConnections.maxBulkVoltage == myConnections.minSourceVoltage || myConnections.minSourceVoltage == UNKNOWN_VOLTAGE)
-					&& (myConnections.maxBulkVoltage == myConnections.minDrainVoltage || myConnections.minDrainVoltage == UNKNOWN_VOLTAGE) ) continue;
-				// no error if max bulk = min source = min drain
-			if ( myConnections.minBulkPower_p && myConnections.minBulkPower_p->type[HIZ_BIT] ) {
-				if ( myConnections.sourceId == myConnections.bulkId && myConnections.drainId == myConnections.bulkId ) continue;
-				if ( myConnections.minSourcePower_p && ! myConnections.minBulkPower_p->IsRelatedPower(myConnections.minSourcePower_p, netVoltagePtr_v, minNet_v, minNet_v, false) ) {
-					myErrorFlag = true;
-				} else if ( myConnections.simSourcePower_p && IsKnownVoltage_(myConnections.simSourcePower_p->simVoltage)
-						&& ! myConnections.minBulkPower_p->IsRelatedPower(myConnections.simSourcePower_p, netVoltagePtr_v, minNet_v, simNet_v, false)
-						&& myConnections.simSourceVoltage < myConnections.maxBulkVoltage ) {
-					myErrorFlag = true;
-				} else if ( myConnections.maxSourcePower_p && ! myConnections.minBulkPower_p->IsRelatedPower(myConnections.maxSourcePower_p, netVoltagePtr_v, minNet_v, maxNet_v, false) ) {
-					myErrorFlag = true;
-				} else if ( myConnections.minDrainPower_p && ! myConnections.minBulkPower_p->IsRelatedPower(myConnections.minDrainPower_p, netVoltagePtr_v, minNet_v, minNet_v, false) ) {
-					myErrorFlag = true;
-				} else if ( myConnections.simDrainPower_p && IsKnownVoltage_(myConnections.simDrainPower_p->simVoltage)
-						&& ! myConnections.minBulkPower_p->IsRelatedPower(myConnections.simDrainPower_p, netVoltagePtr_v, minNet_v, simNet_v, false)
-						&& myConnections.simDrainVoltage < myConnections.maxBulkVoltage ) {
-					myErrorFlag = true;
-				} else if ( myConnections.maxDrainPower_p && ! myConnections.minBulkPower_p->IsRelatedPower(myConnections.maxDrainPower_p, netVoltagePtr_v, minNet_v, maxNet_v, false) ) {
-					myErrorFlag = true;
-				}
-			} else if ( myConnections.CheckTerminalMinVoltages(BULK) == false ) {
-				if ( myConnections.minSourcePower_p || myConnections.simSourcePower_p || myConnections.maxSourcePower_p ||
-						myConnections.minDrainPower_p || myConnections.simDrainPower_p || myConnections.maxDrainPower_p ) { // has some connection (all connections open -> no error)
-					myErrorFlag = true;
-				}
-			} else if ( myConnections.CheckTerminalMinVoltages(BULK | SOURCE) &&
-					( myConnections.minBulkVoltage - myConnections.minSourceVoltage > cvcParameters.cvcBiasErrorThreshold ||
-						( myConnections.minSourceVoltage == myConnections.minBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.masterMinSourceNet.finalResistance < myConnections.masterMinBulkNet.finalResistance) ) ) {
-				mySourceError = true;
-			} else if (	myConnections.CheckTerminalMinVoltages(BULK | DRAIN) &&
-					( myConnections.minBulkVoltage - myConnections.minDrainVoltage > cvcParameters.cvcBiasErrorThreshold ||
-						( myConnections.minDrainVoltage == myConnections.minBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.masterMinDrainNet.finalResistance < myConnections.masterMinBulkNet.finalResistance) ) ) {
-				myDrainError = true;
-			} else if (	myConnections.CheckTerminalSimVoltages(BULK | SOURCE) &&
-					( myConnections.simBulkVoltage - myConnections.simSourceVoltage > cvcParameters.cvcBiasErrorThreshold ||
-						( myConnections.simSourceVoltage == myConnections.simBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.masterSimSourceNet.finalResistance < myConnections.masterSimBulkNet.finalResistance) ) ) {
+void CCvcDb::CheckPmosSourceVsBulk(CFullConnection & theConnections, ogzstream & theErrorFile, unordered_set<netId_t> & theProblemNets) {
+	if ( theConnections.sourceId == theConnections.drainId && theConnections.sourceId == theConnections.bulkId ) return;  // ignore drain = source = bulk
+	bool myErrorFlag = false;
+	bool myUnrelatedFlag = false;
+	bool mySourceError = false;
+	bool myDrainError = false;
+	if ( ! theConnections.maxBulkPower_p
+			|| (theConnections.maxBulkPower_p->IsRelatedPower(theConnections.maxSourcePower_p, netVoltagePtr_v, maxNet_v, maxNet_v, true, true)
+				&& theConnections.maxBulkPower_p->IsRelatedPower(theConnections.maxDrainPower_p, netVoltagePtr_v, maxNet_v, maxNet_v, true, true)) ) {
+		// if relatives (default), then checks are conditional
+		if ( (theConnections.minBulkVoltage == theConnections.maxSourceVoltage || theConnections.maxSourceVoltage == UNKNOWN_VOLTAGE)
+				&& (theConnections.minBulkVoltage == theConnections.maxDrainVoltage || theConnections.maxDrainVoltage == UNKNOWN_VOLTAGE) ) return;
+			 // no error if min bulk = max source = max drain
+		if ( theConnections.maxBulkPower_p && theConnections.maxBulkPower_p->type[HIZ_BIT] ) {
+			if ( theConnections.minSourcePower_p && ! theConnections.maxBulkPower_p->IsRelatedPower(theConnections.minSourcePower_p, netVoltagePtr_v, maxNet_v, minNet_v, false) ) {
 				myErrorFlag = true;
-			} else if (	myConnections.CheckTerminalSimVoltages(BULK | DRAIN) &&
-					( myConnections.simBulkVoltage - myConnections.simDrainVoltage > cvcParameters.cvcBiasErrorThreshold ||
-						( myConnections.simDrainVoltage == myConnections.simBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.masterSimDrainNet.finalResistance < myConnections.masterSimBulkNet.finalResistance) ) ) {
+			} else if ( theConnections.simSourcePower_p && IsKnownVoltage_(theConnections.simSourcePower_p->simVoltage)
+					&& ! theConnections.maxBulkPower_p->IsRelatedPower(theConnections.simSourcePower_p, netVoltagePtr_v, maxNet_v, simNet_v, false)
+					&& theConnections.simSourceVoltage > theConnections.minBulkVoltage ) {
 				myErrorFlag = true;
-			} else if (	myConnections.CheckTerminalMaxVoltages(BULK | SOURCE) &&
-					( ( myConnections.maxBulkVoltage - myConnections.maxSourceVoltage > cvcParameters.cvcBiasErrorThreshold &&
-							myConnections.maxSourcePower_p->defaultMaxNet != myConnections.bulkId ) ||
-						( myConnections.maxSourceVoltage == myConnections.maxBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.maxSourceVoltage != myConnections.minBulkVoltage && // no leak path
-	//						myConnections.masterMinBulkNet.finalNetId != myConnections.masterMaxBulkNet.finalNetId &&
-							myConnections.masterMaxSourceNet.finalResistance > myConnections.masterMaxBulkNet.finalResistance &&
-							! myConnections.minBulkPower_p->type[HIZ_BIT] &&
-							! PathContains(maxNet_v, myConnections.sourceId, myConnections.bulkId)) ) ) { // resistance check backwards in NMOS max (ignore connections through self)
+			} else if ( theConnections.maxSourcePower_p && ! theConnections.maxBulkPower_p->IsRelatedPower(theConnections.maxSourcePower_p, netVoltagePtr_v, maxNet_v, maxNet_v, false) ) {
 				myErrorFlag = true;
-	// Added 20140523
-			} else if (	myConnections.CheckTerminalMaxVoltages(BULK | DRAIN) &&
-					( ( myConnections.maxBulkVoltage - myConnections.maxDrainVoltage > cvcParameters.cvcBiasErrorThreshold &&
-							myConnections.maxDrainPower_p->defaultMaxNet != myConnections.bulkId ) ||
-						( myConnections.maxDrainVoltage == myConnections.maxBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.maxDrainVoltage != myConnections.minBulkVoltage && // no leak path
-	//						myConnections.masterMinBulkNet.finalNetId != myConnections.masterMaxBulkNet.finalNetId &&
-							myConnections.masterMaxDrainNet.finalResistance > myConnections.masterMaxBulkNet.finalResistance &&
-							! myConnections.minBulkPower_p->type[HIZ_BIT] &&
-							! PathContains(maxNet_v, myConnections.drainId, myConnections.bulkId)) ) ) { // resistance check backwards in NMOS max (ignore connections through self)
+			} else if ( theConnections.minDrainPower_p && ! theConnections.maxBulkPower_p->IsRelatedPower(theConnections.minDrainPower_p, netVoltagePtr_v, maxNet_v, minNet_v, false) ) {
+				myErrorFlag = true;
+			} else if ( theConnections.simDrainPower_p && IsKnownVoltage_(theConnections.simDrainPower_p->simVoltage)
+					&& ! theConnections.maxBulkPower_p->IsRelatedPower(theConnections.simDrainPower_p, netVoltagePtr_v, maxNet_v, simNet_v, false)
+					&& theConnections.simDrainVoltage > theConnections.minBulkVoltage ) {
+				myErrorFlag = true;
+			} else if ( theConnections.maxDrainPower_p && ! theConnections.maxBulkPower_p->IsRelatedPower(theConnections.maxDrainPower_p, netVoltagePtr_v, maxNet_v, maxNet_v, false) ) {
 				myErrorFlag = true;
 			}
-		} else {
-			myErrorFlag = true; // if not relatives, always an error
-			myUnrelatedFlag = true;
-		}
-		if ( gSetup_cvc ) {
-			if ( myDrainError ) {
-				myProblemNets.insert(myConnections.drainId);
-			} else if ( mySourceError ) {
-				myProblemNets.insert(myConnections.sourceId);
-			}
-		} else if ( myErrorFlag || myDrainError || mySourceError ) {
-			if ( IncrementDeviceError(myConnections.deviceId, NMOS_SOURCE_BULK) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
-				if ( myUnrelatedFlag ) {
-					errorFile << "Unrelated power error" << endl;
-				}
-				PrintDeviceWithAllConnections(deviceParent_v[device_it], myConnections, errorFile);
-				errorFile << endl;
+		} else if ( theConnections.CheckTerminalMaxVoltages(BULK) == false ) {
+			if ( theConnections.minSourcePower_p || theConnections.simSourcePower_p || theConnections.maxSourcePower_p ||
+					theConnections.minDrainPower_p || theConnections.simDrainPower_p || theConnections.maxDrainPower_p ) { // has some connection (all connections open -> no error)
+				myErrorFlag = true;
 			}
+		} else if (	theConnections.CheckTerminalMinVoltages(BULK | SOURCE) &&
+				( ( theConnections.minSourceVoltage - theConnections.minBulkVoltage > cvcParameters.cvcBiasErrorThreshold &&
+						theConnections.minSourcePower_p->defaultMinNet != theConnections.bulkId ) ||
+					( theConnections.minSourceVoltage == theConnections.minBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+	//						theConnections.masterMinBulkNet.finalNetId != theConnections.masterMaxBulkNet.finalNetId &&
+						theConnections.minSourceVoltage != theConnections.maxBulkVoltage && // no leak path
+						theConnections.masterMinSourceNet.finalResistance > theConnections.masterMinBulkNet.finalResistance &&
+						! theConnections.maxBulkPower_p->type[HIZ_BIT] &&
+						! PathContains(minNet_v, theConnections.sourceId, theConnections.bulkId)) ) ) { // resistance check backwards in PMOS min (ignore connections through self)
+			myErrorFlag = true;
+		} else if (	theConnections.CheckTerminalMinVoltages(BULK | DRAIN) &&
+				( ( theConnections.minDrainVoltage - theConnections.minBulkVoltage > cvcParameters.cvcBiasErrorThreshold &&
+						theConnections.minDrainPower_p->defaultMinNet != theConnections.bulkId ) ||
+					( theConnections.minDrainVoltage == theConnections.minBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+	//						theConnections.masterMinBulkNet.finalNetId != theConnections.masterMaxBulkNet.finalNetId &&
+						theConnections.minDrainVoltage != theConnections.maxBulkVoltage && // no leak path
+						theConnections.masterMinDrainNet.finalResistance > theConnections.masterMinBulkNet.finalResistance &&
+						! theConnections.maxBulkPower_p->type[HIZ_BIT] &&
+						! PathContains(minNet_v, theConnections.drainId, theConnections.bulkId)) ) ) { // resistance check backwards in PMOS min (ignore connections through self)
+			myErrorFlag = true;
+		} else if (	theConnections.CheckTerminalSimVoltages(BULK | SOURCE) &&
+				( theConnections.simSourceVoltage - theConnections.simBulkVoltage > cvcParameters.cvcBiasErrorThreshold ||
+					( theConnections.simSourceVoltage == theConnections.simBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.masterSimSourceNet.finalResistance < theConnections.masterSimBulkNet.finalResistance) ) ) {
+			myErrorFlag = true;
+		} else if (	theConnections.CheckTerminalSimVoltages(BULK | DRAIN) &&
+				( theConnections.simDrainVoltage - theConnections.simBulkVoltage > cvcParameters.cvcBiasErrorThreshold ||
+					( theConnections.simDrainVoltage == theConnections.simBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.masterSimDrainNet.finalResistance < theConnections.masterSimBulkNet.finalResistance) ) ) {
+			myErrorFlag = true;
+		} else if (	theConnections.CheckTerminalMaxVoltages(BULK | SOURCE) &&
+				( theConnections.maxSourceVoltage - theConnections.maxBulkVoltage > cvcParameters.cvcBiasErrorThreshold ||
+					( theConnections.maxSourceVoltage == theConnections.maxBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.masterMaxSourceNet.finalResistance < theConnections.masterMaxBulkNet.finalResistance) ) ) {
+			mySourceError = true;
+		} else if (	theConnections.CheckTerminalMaxVoltages(BULK | DRAIN) &&
+				( theConnections.maxDrainVoltage - theConnections.maxBulkVoltage > cvcParameters.cvcBiasErrorThreshold ||
+					( theConnections.maxDrainVoltage == theConnections.maxBulkVoltage &&
+						cvcParameters.cvcBiasErrorThreshold == 0 &&
+						theConnections.masterMaxDrainNet.finalResistance < theConnections.masterMaxBulkNet.finalResistance) ) ) {
+			myDrainError = true;
 		}
+	} else {
+		myUnrelatedFlag = true;
+		myErrorFlag = true; // if not relatives, always an error
 	}
 	if ( gSetup_cvc ) {
-		reportFile << endl << "CVC SETUP: nmos bias problems" << endl << endl;
-		unordered_set<netId_t> myPrintedNets;
-		unordered_set<netId_t> myParentNets;
-		for ( auto net_pit = myProblemNets.begin(); net_pit != myProblemNets.end(); net_pit++ ) {
-			netId_t myNextNet = *net_pit;
-			while(myNextNet != minNet_v[myNextNet].nextNetId) {
-				myNextNet = minNet_v[myNextNet].nextNetId;
-				myParentNets.insert(myNextNet);
-			}
+		if ( myDrainError ) {
+			theProblemNets.insert(theConnections.drainId);
+		} else if ( mySourceError ) {
+			theProblemNets.insert(theConnections.sourceId);
 		}
-		for ( auto net_pit = myProblemNets.begin(); net_pit != myProblemNets.end(); net_pit++ ) {
-			if ( myParentNets.count(*net_pit) ) continue;
-			netId_t traceNet_it = *net_pit;
-			reportFile << endl;
-			PrintNetWithModelCounts(traceNet_it, SOURCE | DRAIN);
-			while ( traceNet_it != minNet_v[traceNet_it].nextNetId ) {
-				traceNet_it = minNet_v[traceNet_it].nextNetId;
-				if ( traceNet_it == minNet_v[traceNet_it].nextNetId ) {
-					reportFile << NetName(traceNet_it, PRINT_CIRCUIT_ON) << endl;
-				} else {
-					PrintNetWithModelCounts(traceNet_it, SOURCE | DRAIN);
-					if ( myPrintedNets.count(traceNet_it) ) {
-						reportFile << "**********" << endl;
-						break;
-					}
-					myPrintedNets.insert(traceNet_it);
-				}
+	} else if ( myErrorFlag || myDrainError || mySourceError ) {
+		if ( IncrementDeviceError(theConnections.deviceId, PMOS_SOURCE_BULK) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
+			if ( myUnrelatedFlag ) {
+				theErrorFile << "Unrelated power error" << endl;
 			}
+			PrintDeviceWithAllConnections(deviceParent_v[theConnections.deviceId], theConnections, theErrorFile);
+			theErrorFile << endl;
 		}
-	} else {
-		cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking nmos source/drain vs bias errors: ");
 	}
 }
 
-void CCvcDb::FindPmosSourceVsBulkErrors() {
-	CFullConnection myConnections;
-	reportFile << "! Checking pmos source/drain vs bias errors: " << endl << endl;
-	errorFile << "! Checking pmos source/drain vs bias errors: " << endl << endl;
-	unordered_set<netId_t> myProblemNets;
-	for ( deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
-		CInstance * myInstance_p = instancePtr_v[deviceParent_v[device_it]];
-		CCircuit * myParent_p = myInstance_p->master_p;
-		CDevice * myDevice_p = myParent_p->devicePtr_v[device_it - myInstance_p->firstDeviceId];
-		if ( ! IsPmos_(myDevice_p->model_p->type) ) continue;
-		MapDeviceNets(myInstance_p, myDevice_p, myConnections);
-		if ( myConnections.sourceId == myConnections.drainId && myConnections.sourceId == myConnections.bulkId ) continue;  // ignore drain = source = bulk
-		bool myErrorFlag = false;
-		bool myUnrelatedFlag = false;
-		bool mySourceError = false;
-		bool myDrainError = false;
-		if ( ! myConnections.maxBulkPower_p
-				|| (myConnections.maxBulkPower_p->IsRelatedPower(myConnections.maxSourcePower_p, netVoltagePtr_v, maxNet_v, maxNet_v, true, true)
-					&& myConnections.maxBulkPower_p->IsRelatedPower(myConnections.maxDrainPower_p, netVoltagePtr_v, maxNet_v, maxNet_v, true, true)) ) {
-			// if relatives (default), then checks are conditional
-			if ( (myConnections.minBulkVoltage == myConnections.maxSourceVoltage || myConnections.maxSourceVoltage == UNKNOWN_VOLTAGE)
-					&& (myConnections.minBulkVoltage == myConnections.maxDrainVoltage || myConnections.maxDrainVoltage == UNKNOWN_VOLTAGE) ) continue;
-				 // no error if min bulk = max source = max drain
-			if ( myConnections.maxBulkPower_p && myConnections.maxBulkPower_p->type[HIZ_BIT] ) {
-				if ( myConnections.minSourcePower_p && ! myConnections.maxBulkPower_p->IsRelatedPower(myConnections.minSourcePower_p, netVoltagePtr_v, maxNet_v, minNet_v, false) ) {
-					myErrorFlag = true;
-				} else if ( myConnections.simSourcePower_p && IsKnownVoltage_(myConnections.simSourcePower_p->simVoltage)
-						&& ! myConnections.maxBulkPower_p->IsRelatedPower(myConnections.simSourcePower_p, netVoltagePtr_v, maxNet_v, simNet_v, false)
-						&& myConnections.simSourceVoltage > myConnections.minBulkVoltage ) {
-					myErrorFlag = true;
-				} else if ( myConnections.maxSourcePower_p && ! myConnections.maxBulkPower_p->IsRelatedPower(myConnections.maxSourcePower_p, netVoltagePtr_v, maxNet_v, maxNet_v, false) ) {
-					myErrorFlag = true;
-				} else if ( myConnections.minDrainPower_p && ! myConnections.maxBulkPower_p->IsRelatedPower(myConnections.minDrainPower_p, netVoltagePtr_v, maxNet_v, minNet_v, false) ) {
-					myErrorFlag = true;
-				} else if ( myConnections.simDrainPower_p && IsKnownVoltage_(myConnections.simDrainPower_p->simVoltage)
-						&& ! myConnections.maxBulkPower_p->IsRelatedPower(myConnections.simDrainPower_p, netVoltagePtr_v, maxNet_v, simNet_v, false)
-						&& myConnections.simDrainVoltage > myConnections.minBulkVoltage ) {
-					myErrorFlag = true;
-				} else if ( myConnections.maxDrainPower_p && ! myConnections.maxBulkPower_p->IsRelatedPower(myConnections.maxDrainPower_p, netVoltagePtr_v, maxNet_v, maxNet_v, false) ) {
-					myErrorFlag = true;
-				}
-			} else if ( myConnections.CheckTerminalMaxVoltages(BULK) == false ) {
-				if ( myConnections.minSourcePower_p || myConnections.simSourcePower_p || myConnections.maxSourcePower_p ||
-						myConnections.minDrainPower_p || myConnections.simDrainPower_p || myConnections.maxDrainPower_p ) { // has some connection (all connections open -> no error)
-					myErrorFlag = true;
+char GATE_LOGIC_CHECK[] = "GateVsSource logic check";
+
+void CCvcDb::CheckPmosGateVsSource(CFullConnection & theConnections, ogzstream & theErrorFile, bool theSuppressErrorFlag) {
+	CDevice * myDevice_p = theConnections.device_p;
+	bool myVthFlag = false;
+	bool myUnrelatedFlag = false;
+	if ( ! theConnections.maxGatePower_p ) return;
+	if ( theConnections.maxGatePower_p->type[ANALOG_BIT] && ! cvcParameters.cvcAnalogGates ) return;  // ignore analog gate errors
+	if ( IsSCRCPower(theConnections.maxGatePower_p) ) return;  // ignore SCRC input (if not logically ok, should yield floating error)
+	if ( theConnections.maxGatePower_p->IsRelatedPower(theConnections.maxSourcePower_p, netVoltagePtr_v, maxNet_v, maxNet_v, true, true)
+			&& theConnections.maxGatePower_p->IsRelatedPower(theConnections.maxDrainPower_p, netVoltagePtr_v, maxNet_v, maxNet_v, true, true) ) {
+		// if relatives (default), then checks are conditional
+		voltage_t myGateSourceDifference = max(theConnections.maxSourceVoltage, theConnections.maxSourceVoltage + myDevice_p->model_p->Vth) - theConnections.maxGateVoltage;
+		voltage_t myGateDrainDifference = max(theConnections.maxDrainVoltage, theConnections.maxDrainVoltage + myDevice_p->model_p->Vth) - theConnections.maxGateVoltage;
+		voltage_t myMaxVoltageDifference = max(0, myDevice_p->model_p->Vth);
+		if ( theConnections.CheckTerminalMaxVoltages(GATE | SOURCE) &&
+				myGateSourceDifference > myMaxVoltageDifference  &&
+				theConnections.gateId != theConnections.drainId ) {
+			myMaxVoltageDifference = myGateSourceDifference;
+		}
+		if ( theConnections.CheckTerminalMaxVoltages(GATE | DRAIN) &&
+				myGateDrainDifference > myMaxVoltageDifference  &&
+				theConnections.gateId != theConnections.sourceId ) {
+			myMaxVoltageDifference = myGateDrainDifference;
+		}
+		if ( myMaxVoltageDifference <= cvcParameters.cvcGateErrorThreshold
+				|| ( cvcParameters.cvcMinVthGates && myMaxVoltageDifference < -myDevice_p->model_p->Vth ) ) return;  // no error
+		// Skip gates that are always fully on
+		if ( theConnections.CheckTerminalMinVoltages(SOURCE) ) {
+			if ( theConnections.CheckTerminalMinVoltages(DRAIN) ) {
+				if ( theConnections.maxGateVoltage <= min(theConnections.minSourceVoltage, theConnections.minDrainVoltage) + cvcParameters.cvcGateErrorThreshold ) return;
+				if ( theConnections.sourceId == theConnections.drainId ) {  // capacitor check
+					if ( IsPower_(netVoltagePtr_v[theConnections.gateId].full) && IsPower_(netVoltagePtr_v[theConnections.drainId].full) ) return;  // ignore direct power capacitors
+					if ( ! IsInputOrPower_(netVoltagePtr_v[theConnections.masterMinSourceNet.finalNetId].full)
+							|| ! IsInputOrPower_(netVoltagePtr_v[theConnections.masterMinGateNet.finalNetId].full) ) return;  // ignore capacitors connected to non-input/power nets
 				}
-			} else if (	myConnections.CheckTerminalMinVoltages(BULK | SOURCE) &&
-					( ( myConnections.minSourceVoltage - myConnections.minBulkVoltage > cvcParameters.cvcBiasErrorThreshold &&
-							myConnections.minSourcePower_p->defaultMinNet != myConnections.bulkId ) ||
-						( myConnections.minSourceVoltage == myConnections.minBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-	//						myConnections.masterMinBulkNet.finalNetId != myConnections.masterMaxBulkNet.finalNetId &&
-							myConnections.minSourceVoltage != myConnections.maxBulkVoltage && // no leak path
-							myConnections.masterMinSourceNet.finalResistance > myConnections.masterMinBulkNet.finalResistance &&
-							! myConnections.maxBulkPower_p->type[HIZ_BIT] &&
-							! PathContains(minNet_v, myConnections.sourceId, myConnections.bulkId)) ) ) { // resistance check backwards in PMOS min (ignore connections through self)
-				myErrorFlag = true;
-			} else if (	myConnections.CheckTerminalMinVoltages(BULK | DRAIN) &&
-					( ( myConnections.minDrainVoltage - myConnections.minBulkVoltage > cvcParameters.cvcBiasErrorThreshold &&
-							myConnections.minDrainPower_p->defaultMinNet != myConnections.bulkId ) ||
-						( myConnections.minDrainVoltage == myConnections.minBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-	//						myConnections.masterMinBulkNet.finalNetId != myConnections.masterMaxBulkNet.finalNetId &&
-							myConnections.minDrainVoltage != myConnections.maxBulkVoltage && // no leak path
-							myConnections.masterMinDrainNet.finalResistance > myConnections.masterMinBulkNet.finalResistance &&
-							! myConnections.maxBulkPower_p->type[HIZ_BIT] &&
-							! PathContains(minNet_v, myConnections.drainId, myConnections.bulkId)) ) ) { // resistance check backwards in PMOS min (ignore connections through self)
-				myErrorFlag = true;
-			} else if (	myConnections.CheckTerminalSimVoltages(BULK | SOURCE) &&
-					( myConnections.simSourceVoltage - myConnections.simBulkVoltage > cvcParameters.cvcBiasErrorThreshold ||
-						( myConnections.simSourceVoltage == myConnections.simBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.masterSimSourceNet.finalResistance < myConnections.masterSimBulkNet.finalResistance) ) ) {
-				myErrorFlag = true;
-			} else if (	myConnections.CheckTerminalSimVoltages(BULK | DRAIN) &&
-					( myConnections.simDrainVoltage - myConnections.simBulkVoltage > cvcParameters.cvcBiasErrorThreshold ||
-						( myConnections.simDrainVoltage == myConnections.simBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.masterSimDrainNet.finalResistance < myConnections.masterSimBulkNet.finalResistance) ) ) {
-				myErrorFlag = true;
-			} else if (	myConnections.CheckTerminalMaxVoltages(BULK | SOURCE) &&
-					( myConnections.maxSourceVoltage - myConnections.maxBulkVoltage > cvcParameters.cvcBiasErrorThreshold ||
-						( myConnections.maxSourceVoltage == myConnections.maxBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.masterMaxSourceNet.finalResistance < myConnections.masterMaxBulkNet.finalResistance) ) ) {
-				mySourceError = true;
-			} else if (	myConnections.CheckTerminalMaxVoltages(BULK | DRAIN) &&
-					( myConnections.maxDrainVoltage - myConnections.maxBulkVoltage > cvcParameters.cvcBiasErrorThreshold ||
-						( myConnections.maxDrainVoltage == myConnections.maxBulkVoltage &&
-							cvcParameters.cvcBiasErrorThreshold == 0 &&
-							myConnections.masterMaxDrainNet.finalResistance < myConnections.masterMaxBulkNet.finalResistance) ) ) {
-				myDrainError = true;
+			} else {
+				if ( theConnections.maxGateVoltage <= theConnections.minSourceVoltage + cvcParameters.cvcGateErrorThreshold ) return;
 			}
+		} else if ( theConnections.CheckTerminalMinVoltages(DRAIN) ) {
+			if ( theConnections.maxGateVoltage <= theConnections.minDrainVoltage + cvcParameters.cvcGateErrorThreshold ) return;
 		} else {
-			myUnrelatedFlag = true;
-			myErrorFlag = true; // if not relatives, always an error
+			return;  // ignore devices with no min connections
 		}
-		if ( gSetup_cvc ) {
-			if ( myDrainError ) {
-				myProblemNets.insert(myConnections.drainId);
-			} else if ( mySourceError ) {
-				myProblemNets.insert(myConnections.sourceId);
-			}
-		} else if ( myErrorFlag || myDrainError || mySourceError ) {
-			if ( IncrementDeviceError(myConnections.deviceId, PMOS_SOURCE_BULK) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
-				if ( myUnrelatedFlag ) {
-					errorFile << "Unrelated power error" << endl;
-				}
-				PrintDeviceWithAllConnections(deviceParent_v[device_it], myConnections, errorFile);
-				errorFile << endl;
-			}
+		myVthFlag= theConnections.maxGatePower_p->type[MAX_CALCULATED_BIT]
+			&& ( theConnections.maxGateVoltage - theConnections.maxSourceVoltage == myDevice_p->model_p->Vth
+				|| theConnections.maxGateVoltage - theConnections.maxDrainVoltage == myDevice_p->model_p->Vth );
+		if ( myVthFlag && ! cvcParameters.cvcVthGates ) return;
+	} else {
+		myUnrelatedFlag = true; // if not relatives, always an error
+	}
+	if ( theConnections.maxGatePower_p->type[MAX_CALCULATED_BIT] && cvcParameters.cvcLogicDiodes && ! netVoltagePtr_v[theConnections.gateId].full ) {
+		// If the source is a calculated value and the CVC_LOGIC_DIODE switch is on and there is no current definition,
+		// there is no error if the gate logic value is low (WARNING: set to 0V is just a kludge)
+		// check expected value later
+		debugFile << "EXPECT low for GateVsSource: " << NetName(theConnections.gateId) << " at " << DeviceName(theConnections.deviceId, PRINT_CIRCUIT_ON) << endl;
+		CPower * myPower_p = new CPower(theConnections.gateId);
+		myPower_p->definition = CPower::powerDefinitionText.SetTextAddress(GATE_LOGIC_CHECK);
+		myPower_p->extraData = new CExtraPowerData;
+		myPower_p->minVoltage = UNKNOWN_VOLTAGE;
+		myPower_p->simVoltage = UNKNOWN_VOLTAGE;
+		myPower_p->maxVoltage = UNKNOWN_VOLTAGE;
+		myPower_p->type[INPUT_BIT] = false;
+		myPower_p->extraData->expectedSim = "0";
+		cvcParameters.cvcExpectedLevelPtrList.push_back(myPower_p);
+		return;  // Don't flag error here
+	}
+	if ( theSuppressErrorFlag ) return;  // cell error limit is 0
+	if ( IncrementDeviceError(theConnections.deviceId, PMOS_GATE_SOURCE) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
+		if ( myUnrelatedFlag ) {
+			theErrorFile << "Unrelated power error" << endl;
+/*
+		} else if ( theConnections.maxGatePower_p->type[REFERENCE_BIT] ) {
+			theErrorFile << "Gate reference signal" << endl;
+*/
+		} else if ( myVthFlag ) {
+			theErrorFile << "Gate-source = Vth" << endl;
 		}
+		PrintDeviceWithAllConnections(deviceParent_v[theConnections.deviceId], theConnections, theErrorFile);
+		theErrorFile << endl;
 	}
-	if ( gSetup_cvc ) {
-		reportFile << endl << "CVC SETUP: pmos bias problems" << endl << endl;
-		unordered_set<netId_t> myPrintedNets;
-		unordered_set<netId_t> myParentNets;
-		for ( auto net_pit = myProblemNets.begin(); net_pit != myProblemNets.end(); net_pit++ ) {
-			netId_t myNextNet = *net_pit;
-			while(myNextNet != minNet_v[myNextNet].nextNetId) {
-				myNextNet = minNet_v[myNextNet].nextNetId;
-				myParentNets.insert(myNextNet);
-			}
+}
+
+void CCvcDb::PrintBiasProblemNets(unordered_set<netId_t> & theProblemNets, string theMosType) {
+	reportFile << endl << "CVC SETUP: " << theMosType << " bias problems" << endl << endl;
+	unordered_set<netId_t> myPrintedNets;
+	unordered_set<netId_t> myParentNets;
+	for ( auto net_pit = theProblemNets.begin(); net_pit != theProblemNets.end(); net_pit++ ) {
+		netId_t myNextNet = *net_pit;
+		while(myNextNet != minNet_v[myNextNet].nextNetId) {
+			myNextNet = minNet_v[myNextNet].nextNetId;
+			myParentNets.insert(myNextNet);
 		}
-		for ( auto net_pit = myProblemNets.begin(); net_pit != myProblemNets.end(); net_pit++ ) {
-			if ( myParentNets.count(*net_pit) ) continue;
-			netId_t traceNet_it = *net_pit;
-			reportFile << endl;
-			PrintNetWithModelCounts(traceNet_it, SOURCE | DRAIN);
-			while ( traceNet_it != minNet_v[traceNet_it].nextNetId ) {
-				traceNet_it = minNet_v[traceNet_it].nextNetId;
-				if ( traceNet_it == minNet_v[traceNet_it].nextNetId ) {
-					reportFile << NetName(traceNet_it, PRINT_CIRCUIT_ON) << endl;
-				} else {
-					PrintNetWithModelCounts(traceNet_it, SOURCE | DRAIN);
-					if ( myPrintedNets.count(traceNet_it) ) {
-						reportFile << "**********" << endl;
-						break;
-					}
-					myPrintedNets.insert(traceNet_it);
+	}
+	for ( auto net_pit = theProblemNets.begin(); net_pit != theProblemNets.end(); net_pit++ ) {
+		if ( myParentNets.count(*net_pit) ) continue;
+		netId_t traceNet_it = *net_pit;
+		reportFile << endl;
+		PrintNetWithModelCounts(traceNet_it, SOURCE | DRAIN);
+		while ( traceNet_it != minNet_v[traceNet_it].nextNetId ) {
+			traceNet_it = minNet_v[traceNet_it].nextNetId;
+			if ( traceNet_it == minNet_v[traceNet_it].nextNetId ) {
+				reportFile << NetName(traceNet_it, PRINT_CIRCUIT_ON) << endl;
+			} else {
+				PrintNetWithModelCounts(traceNet_it, SOURCE | DRAIN);
+				if ( myPrintedNets.count(traceNet_it) ) {
+					reportFile << "**********" << endl;
+					break;
 				}
+				myPrintedNets.insert(traceNet_it);
 			}
 		}
-	} else {
-		cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking pmos source/drain vs bias errors: ");
 	}
 }
 
@@ -817,6 +908,7 @@ void CCvcDb::FindForwardBiasDiodes() {
 		CCircuit * myParent_p = myInstance_p->master_p;
 		CDevice * myDevice_p = myParent_p->devicePtr_v[device_it - myInstance_p->firstDeviceId];
 //		if ( myDevice_p->model_p->type != DIODE ) continue;
+		if ( myDevice_p->fingerCount == 0 ) continue;  // merged parallel finger
 		if ( IsNmos_(deviceType_v[device_it]) || IsPmos_(deviceType_v[device_it]) ) continue;
 		if ( myDevice_p->model_p->diodeList.empty() ) continue;
 		MapDeviceNets(myInstance_p, myDevice_p, myConnections);
@@ -908,106 +1000,115 @@ void CCvcDb::FindForwardBiasDiodes() {
 	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking forward bias diode errors: ");
 }
 
-void CCvcDb::FindNmosPossibleLeakErrors() {
+void CCvcDb::FindMosPossibleLeakErrors() {
+	// nmos and pmos possible leak checks share one pass over the devices.
 	CFullConnection myConnections;
-	reportFile << "! Checking nmos possible leak errors: " << endl << endl;
-	errorFile << "! Checking nmos possible leak errors: " << endl << endl;
+	string myNmosErrorFileName(GetTemporaryFileName());
+	ogzstream myNmosErrorFile(myNmosErrorFileName);
+	myNmosErrorFile << "! Checking nmos possible leak errors: " << endl << endl;
+	string myPmosErrorFileName(GetTemporaryFileName());
+	ogzstream myPmosErrorFile(myPmosErrorFileName);
+	myPmosErrorFile << "! Checking pmos possible leak errors: " << endl << endl;
 	for ( deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
-		CInstance * myInstance_p = instancePtr_v[deviceParent_v[device_it]];
-		CCircuit * myParent_p = myInstance_p->master_p;
-		CDevice * myDevice_p = myParent_p->devicePtr_v[device_it - myInstance_p->firstDeviceId];
-		if ( ! IsNmos_(myDevice_p->model_p->type) ) continue;
-		bool myErrorFlag = false;
-		MapDeviceNets(myInstance_p, myDevice_p, myConnections);
-		if ( IsKnownVoltage_(myConnections.simGateVoltage) ) continue;
-		if ( myConnections.CheckTerminalMinVoltages(SOURCE | DRAIN) == true ) {
-			voltage_t myMaxGateVoltage = MaxVoltage(myConnections.gateId);
-			if ( myMaxGateVoltage == UNKNOWN_VOLTAGE ) {
-				myMaxGateVoltage = MaxLeakVoltage(myConnections.gateId);
-			}
-			if ( myMaxGateVoltage != UNKNOWN_VOLTAGE
-					&& myMaxGateVoltage <= myConnections.minSourceVoltage + myConnections.device_p->model_p->Vth
-					&& myMaxGateVoltage <= myConnections.minDrainVoltage + myConnections.device_p->model_p->Vth ) {
-				continue;  // always off
-			}
+		if ( IsErrorSuppressed(device_it) ) continue;
+		if ( IsNmos_(deviceType_v[device_it]) ) {
+			MapDeviceNets(device_it, myConnections, GATE, SIM_CONNECTIONS);  // remaining terminals resolved only for unknown gates
+			CheckNmosPossibleLeak(myConnections, myNmosErrorFile);
+		} else if ( IsPmos_(deviceType_v[device_it]) ) {
+			MapDeviceNets(device_it, myConnections, GATE, SIM_CONNECTIONS);
+			CheckPmosPossibleLeak(myConnections, myPmosErrorFile);
 		}
-		if ( myConnections.CheckTerminalSimVoltages(SOURCE | DRAIN) == true ) {
-			if ( myConnections.simSourceVoltage == myConnections.simDrainVoltage ) continue;
-			if ( abs(myConnections.simSourceVoltage - myConnections.simDrainVoltage) <= cvcParameters.cvcLeakErrorThreshold ) continue;
-			if ( myConnections.simSourcePower_p->type[HIZ_BIT] &&
-					! myConnections.simSourcePower_p->IsRelatedPower(myConnections.simDrainPower_p, netVoltagePtr_v, simNet_v, simNet_v, false) ) {
-				;  // possible leaks to cutoff power
-			} else if ( myConnections.simDrainPower_p->type[HIZ_BIT] &&
-					! myConnections.simDrainPower_p->IsRelatedPower(myConnections.simSourcePower_p, netVoltagePtr_v, simNet_v, simNet_v, false) ) {
-				;  // possible leaks to cutoff power
-			} else if ( myConnections.simSourcePower_p->IsInternalOverride() || myConnections.simDrainPower_p->IsInternalOverride() ) {
-				continue;
-			} else if ( myConnections.simSourcePower_p->type[SIM_CALCULATED_BIT] || myConnections.simDrainPower_p->type[SIM_CALCULATED_BIT] ) {
-				if ( myConnections.EstimatedCurrent() <= cvcParameters.cvcLeakLimit ) continue;
-			}
-			myErrorFlag = true;
-		} else if ( myConnections.EstimatedMinimumCurrent() > cvcParameters.cvcLeakLimit ) {
-			myErrorFlag = true;
+	}
+	myNmosErrorFile.close();
+	myPmosErrorFile.close();
+	reportFile << "! Checking nmos possible leak errors: " << endl << endl;
+	CopyErrorFile(myNmosErrorFileName);
+	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking nmos possible leak errors: ", 0, NMOS_MODELS);
+	reportFile << "! Checking pmos possible leak errors: " << endl << endl;
+	CopyErrorFile(myPmosErrorFileName);
+	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking pmos possible leak errors: ", 0, PMOS_MODELS);
+}
+
+void CCvcDb::CheckNmosPossibleLeak(CFullConnection & theConnections, ogzstream & theErrorFile) {
+	bool myErrorFlag = false;
+	if ( IsKnownVoltage_(theConnections.simGateVoltage) ) return;
+	ResolveConnections(theConnections);
+	if ( theConnections.CheckTerminalMinVoltages(SOURCE | DRAIN) == true ) {
+		voltage_t myMaxGateVoltage = MaxVoltage(theConnections.gateId);
+		if ( myMaxGateVoltage == UNKNOWN_VOLTAGE ) {
+			myMaxGateVoltage = MaxLeakVoltage(theConnections.gateId);
 		}
-		if ( myErrorFlag ) {
-			if ( IncrementDeviceError(myConnections.deviceId, NMOS_POSSIBLE_LEAK) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
-				PrintDeviceWithAllConnections(deviceParent_v[device_it], myConnections, errorFile);
-				errorFile << endl;
-			}
+		if ( myMaxGateVoltage != UNKNOWN_VOLTAGE
+				&& myMaxGateVoltage <= theConnections.minSourceVoltage + theConnections.device_p->model_p->Vth
+				&& myMaxGateVoltage <= theConnections.minDrainVoltage + theConnections.device_p->model_p->Vth ) {
+			return;  // always off
+		}
+	}
+	if ( theConnections.CheckTerminalSimVoltages(SOURCE | DRAIN) == true ) {
+		if ( theConnections.simSourceVoltage == theConnections.simDrainVoltage ) return;
+		if ( abs(theConnections.simSourceVoltage - theConnections.simDrainVoltage) <= cvcParameters.cvcLeakErrorThreshold ) return;
+		if ( theConnections.simSourcePower_p->type[HIZ_BIT] &&
+				! theConnections.simSourcePower_p->IsRelatedPower(theConnections.simDrainPower_p, netVoltagePtr_v, simNet_v, simNet_v, false) ) {
+			;  // possible leaks to cutoff power
+		} else if ( theConnections.simDrainPower_p->type[HIZ_BIT] &&
+				! theConnections.simDrainPower_p->IsRelatedPower(theConnections.simSourcePower_p, netVoltagePtr_v, simNet_v, simNet_v, false) ) {
+			;  // possible leaks to cutoff power
+		} else if ( theConnections.simSourcePower_p->IsInternalOverride() || theConnections.simDrainPower_p->IsInternalOverride() ) {
+			return;
+		} else if ( theConnections.simSourcePower_p->type[SIM_CALCULATED_BIT] || theConnections.simDrainPower_p->type[SIM_CALCULATED_BIT] ) {
+			if ( theConnections.EstimatedCurrent() <= cvcParameters.cvcLeakLimit ) return;
+		}
+		myErrorFlag = true;
+	} else if ( theConnections.EstimatedMinimumCurrent() > cvcParameters.cvcLeakLimit ) {
+		myErrorFlag = true;
+	}
+	if ( myErrorFlag ) {
+		if ( IncrementDeviceError(theConnections.deviceId, NMOS_POSSIBLE_LEAK) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
+			PrintDeviceWithAllConnections(deviceParent_v[theConnections.deviceId], theConnections, theErrorFile);
+			theErrorFile << endl;
 		}
 	}
-	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking nmos possible leak errors: ");
 }
 
-void CCvcDb::FindPmosPossibleLeakErrors() {
-	CFullConnection myConnections;
-	reportFile << "! Checking pmos possible leak errors: " << endl << endl;
-	errorFile << "! Checking pmos possible leak errors: " << endl << endl;
-	for ( deviceId_t device_it = 0; device_it < deviceCount; device_it++ ) {
-		CInstance * myInstance_p = instancePtr_v[deviceParent_v[device_it]];
-		CCircuit * myParent_p = myInstance_p->master_p;
-		CDevice * myDevice_p = myParent_p->devicePtr_v[device_it - myInstance_p->firstDeviceId];
-		if ( ! IsPmos_(myDevice_p->model_p->type) ) continue;
-		bool myErrorFlag = false;
-		MapDeviceNets(myInstance_p, myDevice_p, myConnections);
-		if ( IsKnownVoltage_(myConnections.simGateVoltage) ) continue;
-		if ( myConnections.CheckTerminalMaxVoltages(SOURCE | DRAIN) == true ) {
-			voltage_t myMinGateVoltage = MinVoltage(myConnections.gateId);
-			if ( myMinGateVoltage == UNKNOWN_VOLTAGE ) {
-				myMinGateVoltage = MinLeakVoltage(myConnections.gateId);
-			}
-			if ( myMinGateVoltage != UNKNOWN_VOLTAGE
-					&& myMinGateVoltage >= myConnections.maxSourceVoltage + myConnections.device_p->model_p->Vth
-					&& myMinGateVoltage >= myConnections.maxDrainVoltage + myConnections.device_p->model_p->Vth ) {
-				continue;  // always off
-			}
+void CCvcDb::CheckPmosPossibleLeak(CFullConnection & theConnections, ogzstream & theErrorFile) {
+	bool myErrorFlag = false;
+	if ( IsKnownVoltage_(theConnections.simGateVoltage) ) return;
+	ResolveConnections(theConnections);
+	if ( theConnections.CheckTerminalMaxVoltages(SOURCE | DRAIN) == true ) {
+		voltage_t myMinGateVoltage = MinVoltage(theConnections.gateId);
+		if ( myMinGateVoltage == UNKNOWN_VOLTAGE ) {
+			myMinGateVoltage = MinLeakVoltage(theConnections.gateId);
 		}
-		if ( myConnections.CheckTerminalSimVoltages(SOURCE | DRAIN) == true ) {
-			if ( myConnections.simSourceVoltage == myConnections.simDrainVoltage ) continue;
-			if ( abs(myConnections.simSourceVoltage - myConnections.simDrainVoltage) <= cvcParameters.cvcLeakErrorThreshold ) continue;
-			if ( myConnections.simSourcePower_p->type[HIZ_BIT] &&
-					! myConnections.simSourcePower_p->IsRelatedPower(myConnections.simDrainPower_p, netVoltagePtr_v, simNet_v, simNet_v, false) ) {
-				;  // possible leaks to cutoff power
-			} else if ( myConnections.simDrainPower_p->type[HIZ_BIT] &&
-					! myConnections.simDrainPower_p->IsRelatedPower(myConnections.simSourcePower_p, netVoltagePtr_v, simNet_v, simNet_v, false) ) {
-				;  // possible leaks to cutoff power
-			} else if ( myConnections.simSourcePower_p->IsInternalOverride() || myConnections.simDrainPower_p->IsInternalOverride() ) {
-				continue;
-			} else if ( myConnections.simSourcePower_p->type[SIM_CALCULATED_BIT] || myConnections.simDrainPower_p->type[SIM_CALCULATED_BIT] ) {
-				if ( myConnections.EstimatedCurrent() <= cvcParameters.cvcLeakLimit ) continue;
-			}
-			myErrorFlag = true;
-		} else if ( myConnections.EstimatedMinimumCurrent() > cvcParameters.cvcLeakLimit ) {
-			myErrorFlag = true;
+		if ( myMinGateVoltage != UNKNOWN_VOLTAGE
+				&& myMinGateVoltage >= theConnections.maxSourceVoltage + theConnections.device_p->model_p->Vth
+				&& myMinGateVoltage >= theConnections.maxDrainVoltage + theConnections.device_p->model_p->Vth ) {
+			return;  // always off
 		}
-		if ( myErrorFlag ) {
-			if ( IncrementDeviceError(myConnections.deviceId, PMOS_POSSIBLE_LEAK) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
-				PrintDeviceWithAllConnections(deviceParent_v[device_it], myConnections, errorFile);
-				errorFile << endl;
-			}
+	}
+	if ( theConnections.CheckTerminalSimVoltages(SOURCE | DRAIN) == true ) {
+		if ( theConnections.simSourceVoltage == theConnections.simDrainVoltage ) return;
+		if ( abs(theConnections.simSourceVoltage - theConnections.simDrainVoltage) <= cvcParameters.cvcLeakErrorThreshold ) return;
+		if ( theConnections.simSourcePower_p->type[HIZ_BIT] &&
+				! theConnections.simSourcePower_p->IsRelatedPower(theConnections.simDrainPower_p, netVoltagePtr_v, simNet_v, simNet_v, false) ) {
+			;  // possible leaks to cutoff power
+		} else if ( theConnections.simDrainPower_p->type[HIZ_BIT] &&
+				! theConnections.simDrainPower_p->IsRelatedPower(theConnections.simSourcePower_p, netVoltagePtr_v, simNet_v, simNet_v, false) ) {
+			;  // possible leaks to cutoff power
+		} else if ( theConnections.simSourcePower_p->IsInternalOverride() || theConnections.simDrainPower_p->IsInternalOverride() ) {
+			return;
+		} else if ( theConnections.simSourcePower_p->type[SIM_CALCULATED_BIT] || theConnections.simDrainPower_p->type[SIM_CALCULATED_BIT] ) {
+			if ( theConnections.EstimatedCurrent() <= cvcParameters.cvcLeakLimit ) return;
+		}
+		myErrorFlag = true;
+	} else if ( theConnections.EstimatedMinimumCurrent() > cvcParameters.cvcLeakLimit ) {
+		myErrorFlag = true;
+	}
+	if ( myErrorFlag ) {
+		if ( IncrementDeviceError(theConnections.deviceId, PMOS_POSSIBLE_LEAK) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
+			PrintDeviceWithAllConnections(deviceParent_v[theConnections.deviceId], theConnections, theErrorFile);
+			theErrorFile << endl;
 		}
 	}
-	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking pmos possible leak errors: ");
 }
 
 void CCvcDb::FindFloatingInputErrors() {
@@ -1015,23 +1116,65 @@ void CCvcDb::FindFloatingInputErrors() {
 	reportFile << "! Checking mos floating input errors:" << endl << endl;
 	errorFile << "! Checking mos floating input errors:" << endl << endl;
 	bool myFloatingFlag;
+	// Gates checked here are never known, so leak paths and parallel shorts depend only on the source/drain nets.
+	unordered_map<uint64_t, bool> myLeakPathMap;  // key: source, drain
+	unordered_map<uint64_t, bool> myParallelShortMap[2];  // [pmos, nmos] key: lesser net, greater net
+	map<pair<CModel *, uint64_t>, bool> myAlwaysOffMap;  // for the current gate net. key: model, (source, drain)
+	vector<netId_t> mySecondaryNet_v;  // nets that may have no active source/drain connections after the first pass
 	for (netId_t net_it = 0; net_it < netCount; net_it++) {
 		if ( connectionCount_v[net_it].gateCount > 0 ) { // skips subordinate nets. only equivalent master nets have counts
 			if ( firstGate_v[net_it] == UNKNOWN_DEVICE ) continue;
-			MapDeviceNets(firstGate_v[net_it], myConnections);
+			if ( connectionCount_v[net_it].SourceDrainCount() == 0 ) mySecondaryNet_v.push_back(net_it);
+			MapDeviceNets(firstGate_v[net_it], myConnections, GATE, SIM_CONNECTIONS);
 			if ( myConnections.simGateVoltage != UNKNOWN_VOLTAGE ) continue;  // skip known voltages
+			ResolveConnections(myConnections);
 			myFloatingFlag = IsFloatingGate(myConnections);
 			if ( myFloatingFlag || myConnections.IsPossibleHiZ(this) ) {
+				myAlwaysOffMap.clear();
 				for ( deviceId_t device_it = firstGate_v[net_it]; device_it != UNKNOWN_DEVICE; device_it = nextGate_v[device_it] ) {
-					MapDeviceNets(device_it, myConnections);
-					bool myHasLeakPath = HasLeakPath(myConnections);
+					if ( IsErrorSuppressed(device_it) ) {
+						if ( myFloatingFlag ) {
+							deviceStatus_v[device_it][SIM_INACTIVE] = true;
+						}
+						continue;
+					}
+					bool myIsMapped = false;
+					uint64_t myPathKey = FloatingPathKey_(sourceNet_v[device_it], drainNet_v[device_it]);
+					auto myLeakPath_pit = myLeakPathMap.find(myPathKey);
+					bool myHasLeakPath;
+					if ( myLeakPath_pit == myLeakPathMap.end() ) {
+						MapDeviceNets(device_it, myConnections);
+						myIsMapped = true;
+						myHasLeakPath = myLeakPathMap[myPathKey] = HasLeakPath(myConnections);
+					} else {
+						myHasLeakPath = myLeakPath_pit->second;
+					}
 					if ( myFloatingFlag ) {
 						deviceStatus_v[device_it][SIM_INACTIVE] = true;  // ignore true floating input gates (not possible floating)
 					}
-					if ( cvcParameters.cvcIgnoreVthFloating && IsAlwaysOff(myConnections) ) continue;  // skips Hi-Z input that is never on
+					if ( cvcParameters.cvcIgnoreVthFloating ) {
+						CModel * myModel_p = instancePtr_v[deviceParent_v[device_it]]->master_p->devicePtr_v[device_it - instancePtr_v[deviceParent_v[device_it]]->firstDeviceId]->model_p;
+						auto myAlwaysOffKey = make_pair(myModel_p, myPathKey);
+						auto myAlwaysOff_pit = myAlwaysOffMap.find(myAlwaysOffKey);
+						bool myIsAlwaysOff;
+						if ( myAlwaysOff_pit == myAlwaysOffMap.end() ) {
+							if ( ! myIsMapped ) {
+								MapDeviceNets(device_it, myConnections);
+								myIsMapped = true;
+							}
+							myIsAlwaysOff = myAlwaysOffMap[myAlwaysOffKey] = IsAlwaysOff(myConnections);
+						} else {
+							myIsAlwaysOff = myAlwaysOff_pit->second;
+						}
+						if ( myIsAlwaysOff ) continue;  // skips Hi-Z input that is never on
+					}
 					bool myIsPhysicallyFloating = connectionCount_v[net_it].SourceDrainCount() == 0;
 					if ( ! myHasLeakPath && cvcParameters.cvcIgnoreNoLeakFloating && myIsPhysicallyFloating ) continue;  // skip no leak floating
-					bool myHasParallelShort = myConnections.HasParallelShort(this);
+					if ( ! myIsMapped ) {
+						MapDeviceNets(device_it, myConnections);
+						myIsMapped = true;
+					}
+					bool myHasParallelShort = HasParallelShort(myConnections, myParallelShortMap);
 					if ( myHasParallelShort && ( cvcParameters.cvcIgnoreNoLeakFloating || ! myIsPhysicallyFloating ) ) continue;  // skip devices that have source/drain shorted
 					if ( myHasLeakPath || connectionCount_v[net_it].SourceDrainCount() == 0 ) {  // physically floating gates too
 						if ( IncrementDeviceError(myConnections.deviceId, HIZ_INPUT) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
@@ -1045,7 +1188,16 @@ void CCvcDb::FindFloatingInputErrors() {
 			}
 		}
 	}
-	for (netId_t net_it = 0; net_it < netCount; net_it++) {  // second pass to catch floating nets caused by floating nets
+	// only nets with inactive source/drain connections (or none) can be secondary Hi-Z
+	for ( size_t device_it = deviceStatus_v.FindNext(SIM_INACTIVE, 0); device_it < deviceCount; device_it = deviceStatus_v.FindNext(SIM_INACTIVE, device_it + 1) ) {
+		mySecondaryNet_v.push_back(sourceNet_v[device_it]);
+		mySecondaryNet_v.push_back(drainNet_v[device_it]);
+	}
+	sort(mySecondaryNet_v.begin(), mySecondaryNet_v.end());
+	mySecondaryNet_v.erase(unique(mySecondaryNet_v.begin(), mySecondaryNet_v.end()), mySecondaryNet_v.end());
+	for ( auto net_pit = mySecondaryNet_v.begin(); net_pit != mySecondaryNet_v.end(); net_pit++ ) {  // second pass to catch floating nets caused by floating nets
+		netId_t net_it = *net_pit;
+		if ( net_it == UNKNOWN_NET ) continue;
 		if ( connectionCount_v[net_it].gateCount > 0 ) { // skips subordinate nets. only equivalent master nets have counts
 			if ( firstGate_v[net_it] == UNKNOWN_DEVICE ) continue;
 			if ( SimVoltage(net_it) != UNKNOWN_VOLTAGE || (netVoltagePtr_v[net_it].full && netVoltagePtr_v[net_it].full->type[INPUT_BIT]) ) continue;
@@ -1053,9 +1205,17 @@ void CCvcDb::FindFloatingInputErrors() {
 			MapDeviceNets(firstGate_v[net_it], myConnections);
 			if ( IsFloatingGate(myConnections) ) continue;  // Already processed previously
 			for ( deviceId_t device_it = firstGate_v[net_it]; device_it != UNKNOWN_DEVICE; device_it = nextGate_v[device_it] ) {
+				if ( IsErrorSuppressed(device_it) ) continue;
 				MapDeviceNets(device_it, myConnections);
-				if ( myConnections.HasParallelShort(this) ) continue;  // skip devices that have source/drain shorted
-				bool myHasLeakPath = HasLeakPath(myConnections);
+				if ( HasParallelShort(myConnections, myParallelShortMap) ) continue;  // skip devices that have source/drain shorted
+				uint64_t myPathKey = FloatingPathKey_(myConnections.sourceId, myConnections.drainId);
+				auto myLeakPath_pit = myLeakPathMap.find(myPathKey);
+				bool myHasLeakPath;
+				if ( myLeakPath_pit == myLeakPathMap.end() ) {
+					myHasLeakPath = myLeakPathMap[myPathKey] = HasLeakPath(myConnections);
+				} else {
+					myHasLeakPath = myLeakPath_pit->second;
+				}
 				if ( myHasLeakPath ) {
 					if ( IncrementDeviceError(myConnections.deviceId, HIZ_INPUT) < cvcParameters.cvcCircuitErrorLimit || cvcParameters.cvcCircuitErrorLimit == 0 ) {
 						errorFile << "* Secondary HI-Z error" << endl;
@@ -1069,6 +1229,19 @@ void CCvcDb::FindFloatingInputErrors() {
 	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Checking mos floating input errors:");
 }
 
+bool CCvcDb::HasParallelShort(CFullConnection & theConnections, unordered_map<uint64_t, bool> theParallelShortMap[2]) {
+	/// Memoized CFullConnection::HasParallelShort for devices with unknown gates. The device itself is never on, so only the net pair matters.
+	netId_t myLesserNet = min(theConnections.sourceId, theConnections.drainId);
+	netId_t myGreaterNet = max(theConnections.sourceId, theConnections.drainId);
+	uint64_t myKey = FloatingPathKey_(myLesserNet, myGreaterNet);
+	unordered_map<uint64_t, bool> & myShortMap = theParallelShortMap[IsNmos_(theConnections.device_p->model_p->type) ? 1 : 0];
+	auto myShort_pit = myShortMap.find(myKey);
+	if ( myShort_pit != myShortMap.end() ) return myShort_pit->second;
+	bool myHasParallelShort = theConnections.HasParallelShort(this);
+	myShortMap[myKey] = myHasParallelShort;
+	return myHasParallelShort;
+}
+
 void CCvcDb::CheckExpectedValues() {
 	CFullConnection myConnections;
 	netId_t myNetId, mySimNetId, myMinNetId, myMaxNetId;
@@ -1205,7 +1378,7 @@ void CCvcDb::FindLDDErrors() {
 				while (myDevice_p) {
 					CCircuit * myParent_p = myDevice_p->parent_p;
 	//				deviceId_t myLocalDeviceId = myParent_p->localDeviceIdMap[myDevice_p->name];
-					for (instanceId_t instance_it = 0; instance_it < myParent_p->instanceId_v.size(); instance_it++) {
+					for (instanceId_t instance_it = 0; instance_it < myParent_p->instanceId_v.size() && myDevice_p->fingerCount > 0; instance_it++) {  // merged fingers are checked with the first finger
 						if  ( instancePtr_v[myParent_p->instanceId_v[instance_it]]->IsParallelInstance() ) continue;  // parallel/empty instances
 						CInstance * myInstance_p = instancePtr_v[myParent_p->instanceId_v[instance_it]];
 						MapDeviceNets(myInstance_p, myDevice_p, myConnections);
@@ -34,6 +34,8 @@
 #include <csignal>
 #include <sys/stat.h>
 #include <regex>
+#include <tuple>
+#include <chrono>
 #include "mmappable_vector.h"
 
 extern CCvcDb * gCvcDb;
@@ -119,7 +121,16 @@ void CCvcDb::CountObjectsAndLinkSubcircuits() {
 	catch (const out_of_range& oor_exception) {
 		throw EFatalError("could not find subcircuit: " + cvcParameters.cvcTopBlock);
 	}
+	if ( cvcParameters.cvcMergeIdenticalCircuits ) MergeIdenticalCircuits();
 	topCircuit_p->CountObjectsAndLinkSubcircuits(cvcCircuitList.circuitNameMap);
+	size_t mySignalIdCount = 0;
+	size_t myMasterDeviceCount = 0;
+	for (CCircuitPtrList::iterator circuit_ppit = cvcCircuitList.begin(); circuit_ppit != cvcCircuitList.end(); circuit_ppit++) {
+		mySignalIdCount += (*circuit_ppit)->signalIdPool_v.size();
+		myMasterDeviceCount += (*circuit_ppit)->devicePtr_v.size() + (*circuit_ppit)->subcircuitPtr_v.size();
+	}
+	logFile << "Master devices " << myMasterDeviceCount << " of " << sizeof(CDevice) << " bytes; signal ids " << mySignalIdCount
+		<< " in circuit pools (" << mySignalIdCount * sizeof(netId_t) << " bytes)" << endl;
 	topCircuit_p->netCount += topCircuit_p->portCount;
 	topCircuit_p->subcircuitCount++;
 	topCircuit_p->instanceCount++;
@@ -128,21 +139,93 @@ void CCvcDb::CountObjectsAndLinkSubcircuits() {
 	}
 }
 
+void CCvcDb::MergeIdenticalCircuits() {
+	/// Replace circuits that differ only in name by the first equivalent circuit. Merged names remain in circuitNameMap as aliases.
+	// Models restricted to cells must select the same models for both names.
+	vector<regex *> myCellFilter_v;
+	for ( auto modelList_pit = cvcParameters.cvcModelListMap.begin(); modelList_pit != cvcParameters.cvcModelListMap.end(); modelList_pit++ ) {
+		for ( auto model_pit = modelList_pit->second.begin(); model_pit != modelList_pit->second.end(); model_pit++ ) {
+			if ( model_pit->cellFilterRegex_p ) myCellFilter_v.push_back(model_pit->cellFilterRegex_p);
+		}
+	}
+	unordered_map<uint64_t, list<CCircuit *>> myStructureMap;
+	unordered_set<CCircuit *> myVisitedCircuits;
+	list<CCircuit *> myMergedCircuits;
+	MergeIdenticalCircuits(topCircuit_p, myCellFilter_v, myStructureMap, myVisitedCircuits, myMergedCircuits);
+	for ( auto circuit_ppit = myMergedCircuits.begin(); circuit_ppit != myMergedCircuits.end(); circuit_ppit++ ) {
+		cvcCircuitList.remove(*circuit_ppit);
+		delete (*circuit_ppit);
+	}
+	reportFile << "Merged identical circuits " << myMergedCircuits.size() << endl;
+}
+
+void CCvcDb::MergeIdenticalCircuits(CCircuit * theCircuit_p, vector<regex *> & theCellFilter_v, unordered_map<uint64_t, list<CCircuit *>> & theStructureMap,
+		unordered_set<CCircuit *> & theVisitedCircuits, list<CCircuit *> & theMergedCircuits) {
+	/// Children first, so that identical children already resolve to the same master when the parent is compared.
+	theVisitedCircuits.insert(theCircuit_p);
+	for ( auto subcircuit_ppit = theCircuit_p->subcircuitPtr_v.begin(); subcircuit_ppit != theCircuit_p->subcircuitPtr_v.end(); subcircuit_ppit++ ) {
+		auto myMaster_pit = cvcCircuitList.circuitNameMap.find((*subcircuit_ppit)->masterName);
+		if ( myMaster_pit == cvcCircuitList.circuitNameMap.end() ) continue;  // reported when linking
+		if ( theVisitedCircuits.count(myMaster_pit->second) == 0 ) {
+			MergeIdenticalCircuits(myMaster_pit->second, theCellFilter_v, theStructureMap, theVisitedCircuits, theMergedCircuits);
+		}
+	}
+	list<CCircuit *> & myCandidates = theStructureMap[theCircuit_p->StructureHash(cvcCircuitList.circuitNameMap)];
+	for ( auto candidate_ppit = myCandidates.begin(); candidate_ppit != myCandidates.end(); candidate_ppit++ ) {
+		if ( ! theCircuit_p->IsSameStructure(*candidate_ppit, cvcCircuitList.circuitNameMap) ) continue;
+		bool mySameModels = true;
+		for ( auto filter_ppit = theCellFilter_v.begin(); filter_ppit != theCellFilter_v.end(); filter_ppit++ ) {
+			if ( regex_match(theCircuit_p->name, **filter_ppit) != regex_match((*candidate_ppit)->name, **filter_ppit) ) mySameModels = false;
+		}
+		if ( ! mySameModels ) continue;
+		logFile << "Merged circuit " << theCircuit_p->name << " into " << (*candidate_ppit)->name << endl;
+		cvcCircuitList.circuitNameMap[theCircuit_p->name] = *candidate_ppit;
+		(*candidate_ppit)->alias_v.push_back(theCircuit_p->name);
+		theMergedCircuits.push_back(theCircuit_p);
+		return;
+	}
+	myCandidates.push_back(theCircuit_p);
+}
+
 void CCvcDb::AssignGlobalIDs() {
 	reportFile << "CVC: Assigning IDs ..." << endl;
 	deviceCount = 0;
 	subcircuitCount = 0;
 	netCount = 0;
-	netParent_v.clear();
+	netParent_v.Reset(cvcParameters.cvcCompactParentIndex);
 	netParent_v.reserve(topCircuit_p->netCount);
-	deviceParent_v.clear();
+	deviceParent_v.Reset(cvcParameters.cvcCompactParentIndex);
 	deviceParent_v.reserve(topCircuit_p->deviceCount);
 
-	instancePtr_v.clear();
-	instancePtr_v.reserve(topCircuit_p->subcircuitCount);
-	instancePtr_v.resize(topCircuit_p->subcircuitCount, NULL);
-	instancePtr_v[0] = new CInstance;
+	instancePtr_v.Allocate(topCircuit_p->subcircuitCount);
 	instancePtr_v[0]->AssignTopGlobalIDs(this, topCircuit_p);
+	for (CCircuitPtrList::iterator circuit_ppit = cvcCircuitList.begin(); circuit_ppit != cvcCircuitList.end(); circuit_ppit++) {
+		(*circuit_ppit)->instanceHashId_v.clear();  // parallel instance tables are not needed after assignment
+		(*circuit_ppit)->instanceHashId_v.shrink_to_fit();
+		(*circuit_ppit)->instanceHash_v.clear();
+		(*circuit_ppit)->instanceHash_v.shrink_to_fit();
+	}
+	PrintParentIndex("net", netParent_v);
+	PrintParentIndex("device", deviceParent_v);
+}
+
+void CCvcDb::PrintParentIndex(string theName, CParentIndex & theIndex) {
+	/// Memory use and sampled lookup time of a parent index
+	if ( theIndex.size() == 0 ) return;
+	size_t mySampleCount = min(theIndex.size(), size_t(1) << 20);
+	size_t myId = 0;
+	instanceId_t myCheckSum = 0;
+	auto myStart = chrono::steady_clock::now();
+	for ( size_t sample_it = 0; sample_it < mySampleCount; sample_it++ ) {
+		myId = ( myId + 2654435761u ) % theIndex.size();  // spread samples over the whole index
+		myCheckSum += theIndex[myId];
+	}
+	double myLookupTime = chrono::duration<double, nano>(chrono::steady_clock::now() - myStart).count() / mySampleCount;
+	logFile << "Parent index " << theName << ": " << theIndex.size() << " ids";
+	if ( theIndex.RangeCount() > 0 ) logFile << " in " << theIndex.RangeCount() << " ranges";
+	logFile << " " << theIndex.MemorySize() << " bytes (flat " << theIndex.size() * sizeof(instanceId_t) << ") ";
+	logFile << int(myLookupTime * 10) / 10.0 << "ns/lookup" << endl;
+	debugFile << "DEBUG: parent index " << theName << " checksum " << myCheckSum << endl;
 }
 
 void CCvcDb::ResetMinSimMaxAndQueues() {
@@ -221,6 +304,7 @@ void CCvcDb::MakeEquivalentNets(CNetMap & theNetMap, netId_t theFirstNetId, netI
 	} else {
 		return; // already equivalent
 	}
+	bool myGreaterHasPower = ( netVoltagePtr_v[myGreaterNetId].full != NULL );
 	bool mySamePowerFlag;
 	CPower * myMasterPower_p = SetMasterPower(theFirstNetId, theSecondNetId, mySamePowerFlag);
 	netId_t myMinorNetId = ( netVoltagePtr_v[myGreaterNetId].full == myMasterPower_p ) ? myLesserNetId : myGreaterNetId;
@@ -237,13 +321,23 @@ void CCvcDb::MakeEquivalentNets(CNetMap & theNetMap, netId_t theFirstNetId, netI
 	}
 	if ( myMasterPower_p ) {
 		netVoltagePtr_v[myMinorNetId].full = myMasterPower_p;
-		for ( auto net_pit = theNetMap[myMinorNetId].begin(); net_pit != theNetMap[myMinorNetId].end(); net_pit++ ) {
-			netVoltagePtr_v[*net_pit].full = myMasterPower_p;
+		auto myMinorNetList_pit = theNetMap.find(myMinorNetId);
+		if ( myMinorNetList_pit != theNetMap.end() ) {
+			for ( auto net_pit = myMinorNetList_pit->second.begin(); net_pit != myMinorNetList_pit->second.end(); net_pit++ ) {
+				netVoltagePtr_v[*net_pit].full = myMasterPower_p;
+			}
 		}
 	}
-	theNetMap[myLesserNetId].push_front(myGreaterNetId);
-	if ( theNetMap.count(myGreaterNetId) > 0 ) {
-		theNetMap[myLesserNetId].splice_after(theNetMap[myLesserNetId].before_begin(), theNetMap[myGreaterNetId]);
+	// Only subordinate nets with power are listed. Other subordinate power pointers are cleared when equivalence is fixed.
+	auto myGreaterNetList_pit = theNetMap.find(myGreaterNetId);
+	if ( myGreaterHasPower || myGreaterNetList_pit != theNetMap.end() ) {
+		forward_list<netId_t> myLesserNetList;
+		if ( myGreaterHasPower ) myLesserNetList.push_front(myGreaterNetId);
+		if ( myGreaterNetList_pit != theNetMap.end() ) {
+			myLesserNetList.splice_after(myLesserNetList.before_begin(), myGreaterNetList_pit->second);
+			theNetMap.erase(myGreaterNetList_pit);
+		}
+		theNetMap[myLesserNetId].splice_after(theNetMap[myLesserNetId].before_begin(), myLesserNetList);
 	}
 	equivalentNet_v[myGreaterNetId] = myLesserNetId;
 }
@@ -277,14 +371,14 @@ void CCvcDb::SetEquivalentNets() {
 						try {
 							// short source and drain
 							MakeEquivalentNets(myEquivalentNetMap,
-									myInstance_p->localToGlobalNetId_v[myDevice_p->signalId_v[0]],
-									myInstance_p->localToGlobalNetId_v[myDevice_p->signalId_v[1]],
+									myInstance_p->LocalToGlobalNetId(myDevice_p->signalId_v[0]),
+									myInstance_p->LocalToGlobalNetId(myDevice_p->signalId_v[1]),
 									myDeviceId);
 						}
 						catch (const EEquivalenceError& myException) {
 							CFullConnection myConnections;
-							myConnections.originalSourceId = myInstance_p->localToGlobalNetId_v[myDevice_p->signalId_v[0]];
-							myConnections.originalDrainId = myInstance_p->localToGlobalNetId_v[myDevice_p->signalId_v[1]];
+							myConnections.originalSourceId = myInstance_p->LocalToGlobalNetId(myDevice_p->signalId_v[0]);
+							myConnections.originalDrainId = myInstance_p->LocalToGlobalNetId(myDevice_p->signalId_v[1]);
 							myConnections.masterSimSourceNet.finalNetId = GetEquivalentNet(myConnections.originalSourceId);
 							myConnections.masterSimDrainNet.finalNetId = GetEquivalentNet(myConnections.originalDrainId);
 							myConnections.simSourceVoltage = SimVoltage(myConnections.masterSimSourceNet.finalNetId);
@@ -313,15 +407,44 @@ void CCvcDb::SetEquivalentNets() {
 		}
 	}
 	cvcCircuitList.PrintAndResetCircuitErrors(this, cvcParameters.cvcCircuitErrorLimit, logFile, errorFile, "! Switch shorts");
+	// flatten to the least equivalent net. parents are always less than children.
+	for (netId_t net_it = 0; net_it < equivalentNet_v.size(); net_it++) {
+		equivalentNet_v[net_it] = equivalentNet_v[equivalentNet_v[net_it]];
+	}
+	// then to the power definition net. least nets are processed after their subordinates.
 	// following iterator must be int! netId_t results in infinite loop
 	for (int net_it = equivalentNet_v.size() - 1; net_it >= 0; net_it--) {
-		equivalentNet_v[net_it] = GetEquivalentNet(net_it);
+		CPower * myPower_p = netVoltagePtr_v[equivalentNet_v[net_it]].full;
+		if ( myPower_p && myPower_p->netId != UNKNOWN_NET ) equivalentNet_v[net_it] = myPower_p->netId;
 		if ( netVoltagePtr_v[net_it].full && netId_t(net_it) != netVoltagePtr_v[net_it].full->netId ) netVoltagePtr_v[net_it].full = NULL;
 	}
 	myEquivalentNetMap.clear();
 	isFixedEquivalentNet = true;
 }
 
+void CCvcDb::MergeParallelFingers(CCircuit * theCircuit_p) {
+	/// Sets fingerCount for mosfets in theCircuit_p with the same model, parameters and local connections.
+	/// The first finger represents the group. Source/drain order is ignored except for LDD devices.
+	map<tuple<CModel *, text_t, netId_t, netId_t, netId_t, netId_t>, CDevice *> myFingerMap;
+	for (CDevicePtrVector::iterator device_ppit = theCircuit_p->devicePtr_v.begin(); device_ppit != theCircuit_p->devicePtr_v.end(); device_ppit++) {
+		CDevice * myDevice_p = *device_ppit;
+		myDevice_p->fingerCount = 1;
+		modelType_t myType = myDevice_p->model_p->type;
+		if ( ! IsMos_(myType) ) continue;
+		netId_t myDrainId = myDevice_p->signalId_v[0];
+		netId_t mySourceId = myDevice_p->signalId_v[2];
+		if ( mySourceId == myDrainId ) continue;  // mos caps are ignored
+		if ( ( myType == NMOS || myType == PMOS ) && mySourceId > myDrainId ) swap(mySourceId, myDrainId);
+		netId_t myBulkId = ( myDevice_p->signalId_v.size() > 3 ) ? myDevice_p->signalId_v[3] : UNKNOWN_NET;
+		auto myInsert = myFingerMap.insert(make_pair(make_tuple(myDevice_p->model_p, myDevice_p->parameters,
+			myDevice_p->signalId_v[1], mySourceId, myDrainId, myBulkId), myDevice_p));
+		if ( ! myInsert.second ) {
+			myInsert.first->second->fingerCount++;
+			myDevice_p->fingerCount = 0;
+		}
+	}
+}
+
 void CCvcDb::LinkDevices() {
 	reportFile << "CVC: Linking devices..." << endl;
 	ResetVector<CDeviceIdVector>(firstSource_v, netCount, UNKNOWN_DEVICE);
@@ -343,10 +466,18 @@ void CCvcDb::LinkDevices() {
 	deviceId_t myDeviceCount = 0;
 	instanceId_t myInstanceCount = 0;
 	deviceId_t myPrintCount = 0;
+	deviceId_t myMergedFingerCount = 0;
 	register netId_t mySourceNet, myDrainNet, myGateNet; //, myBulkNet;
 	for (CCircuitPtrList::iterator circuit_ppit = cvcCircuitList.begin(); circuit_ppit != cvcCircuitList.end(); circuit_ppit++) {
 		CCircuit * myCircuit_p = *circuit_ppit;
 		if ( myCircuit_p->linked ) {
+			if ( cvcParameters.cvcMergeParallelFingers ) {
+				MergeParallelFingers(myCircuit_p);
+			} else {  // clear merges from a previous run on the same netlist
+				for (CDevicePtrVector::iterator device_ppit = myCircuit_p->devicePtr_v.begin(); device_ppit != myCircuit_p->devicePtr_v.end(); device_ppit++) {
+					(*device_ppit)->fingerCount = 1;
+				}
+			}
 			for (instanceId_t instance_it = 0; instance_it < myCircuit_p->instanceId_v.size(); instance_it++) {
 				if ( instancePtr_v[myCircuit_p->instanceId_v[instance_it]]->IsParallelInstance() ) continue;  // parallel instances
 				myInstanceCount++;
@@ -361,6 +492,12 @@ void CCvcDb::LinkDevices() {
 						cout << "	Average device/instance: " << myDeviceCount << "/" << myInstanceCount << "=" << myDeviceCount / myInstanceCount << "\r" << std::flush;
 						myPrintCount = 0;
 					}
+					if ( myDevice_p->fingerCount == 0 ) {  // merged parallel finger: checked through the first finger
+						deviceType_v[myDeviceId] = UNKNOWN;
+						IgnoreDevice(myDeviceId);
+						myMergedFingerCount++;
+						continue;
+					}
 					if ( sourceNet_v[myDeviceId] == drainNet_v[myDeviceId] ) {
 						IgnoreDevice(myDeviceId);
 						continue;
@@ -415,6 +552,9 @@ void CCvcDb::LinkDevices() {
 		}
 	}
 	cout << endl;
+	if ( cvcParameters.cvcMergeParallelFingers ) {
+		reportFile << "Merged parallel fingers " << myMergedFingerCount << endl;
+	}
 }
 
 returnCode_t CCvcDb::SetDeviceModels() {
@@ -422,6 +562,7 @@ returnCode_t CCvcDb::SetDeviceModels() {
 	reportFile << "CVC: Setting models ..." << endl;
 	parameterResistanceMap.clear();
 	parameterResistanceMap.reserve(cvcCircuitList.parameterText.Entries());
+	cvcParameters.cvcModelListMap.ClearParameterCache();
 	bool myModelError = false;
 	for (CCircuitPtrList::iterator circuit_ppit = cvcCircuitList.begin(); circuit_ppit != cvcCircuitList.end(); circuit_ppit++) {
 		CCircuit * myCircuit_p = *circuit_ppit;
@@ -461,6 +602,8 @@ returnCode_t CCvcDb::SetDeviceModels() {
 			}
 		}
 	}
+	logFile << "Parsed parameter sets " << cvcParameters.cvcModelListMap.parameterCache.size() << endl;
+	cvcParameters.cvcModelListMap.ClearParameterCache();
 	isDeviceModelSet = true;
 	if ( myModelError ) {
 		if ( ! myErrorModelSet.empty() ) {
@@ -700,7 +843,7 @@ forward_list<instanceId_t> CCvcDb::FindInstanceIds(string theHierarchy, instance
 					}
 					catch (const out_of_range& oor_exception) { // check for regex match
 						for ( auto circuit_pit = cvcCircuitList.begin(); circuit_pit != cvcCircuitList.end(); circuit_pit++ ) {
-							if ( regex_match((*circuit_pit)->name, mySearchPattern) ) {
+							if ( (*circuit_pit)->NameMatch(mySearchPattern) ) {
 								for ( auto instance_pit = (*circuit_pit)->instanceId_v.begin(); instance_pit != (*circuit_pit)->instanceId_v.end(); instance_pit++ ) {
 									mySearchInstanceIdList.push_front(*instance_pit);
 									myFoundMatch = true;
@@ -849,10 +992,10 @@ set<netId_t> * CCvcDb::FindUniqueNetIds(string thePowerSignal, instanceId_t theP
 					cout << "Warning: can not define nets in parallel instances " << thePowerSignal << endl;
 					continue;
 				}
-				CTextNetIdMap * mySignalIdMap_p = &(instancePtr_v[*instanceId_pit]->master_p->localSignalIdMap);
+				CTextNetIdArray * mySignalIdMap_p = &(instancePtr_v[*instanceId_pit]->master_p->localSignalIdMap);
 				if ( myExactMatch ) { // exact match
 					if ( mySignalIdMap_p->count(mySignalText) > 0 ) {
-						myNetId = instancePtr_v[*instanceId_pit]->localToGlobalNetId_v[mySignalIdMap_p->at(mySignalText)];
+						myNetId = instancePtr_v[*instanceId_pit]->LocalToGlobalNetId(mySignalIdMap_p->at(mySignalText));
 						if ( myCheckTopPort && *instanceId_pit == 0 && myNetId >= topCircuit_p->portCount ) continue; // top signals that are not ports posing as ports
 						if ( ! myCheckTopPort && *instanceId_pit == 0 && myNetId < topCircuit_p->portCount ) continue; // top signals that should be ports
 						myNetIdSet_p->insert(myNetId);
@@ -861,7 +1004,7 @@ set<netId_t> * CCvcDb::FindUniqueNetIds(string thePowerSignal, instanceId_t theP
 				} else {
 					for ( auto signalIdPair_pit = mySignalIdMap_p->begin(); signalIdPair_pit != mySignalIdMap_p->end(); signalIdPair_pit++ ) {
 						if ( regex_match(signalIdPair_pit->first, mySearchPattern) ) {
-							myNetId = instancePtr_v[*instanceId_pit]->localToGlobalNetId_v[signalIdPair_pit->second];
+							myNetId = instancePtr_v[*instanceId_pit]->LocalToGlobalNetId(signalIdPair_pit->second);
 							if ( myCheckTopPort && *instanceId_pit == 0 && myNetId >= topCircuit_p->portCount ) continue; // top signals that are not ports posing as ports
 							if ( ! myCheckTopPort && *instanceId_pit == 0 && myNetId < topCircuit_p->portCount ) continue; // top signals that should be ports
 							myNetIdSet_p->insert(myNetId);
@@ -927,9 +1070,9 @@ forward_list<netId_t> * CCvcDb::FindNetIds(string thePowerSignal, instanceId_t t
 					continue;
 
 				}
-				CTextNetIdMap * mySignalIdMap_p = &(instancePtr_v[*instanceId_pit]->master_p->localSignalIdMap);
+				CTextNetIdArray * mySignalIdMap_p = &(instancePtr_v[*instanceId_pit]->master_p->localSignalIdMap);
 				if ( mySignalIdMap_p->count(mySignalText) > 0 ) {
-					myNetId = instancePtr_v[*instanceId_pit]->localToGlobalNetId_v[mySignalIdMap_p->at(mySignalText)];
+					myNetId = instancePtr_v[*instanceId_pit]->LocalToGlobalNetId(mySignalIdMap_p->at(mySignalText));
 					if ( myCheckTopPort && *instanceId_pit == 0 && myNetId >= topCircuit_p->portCount ) continue; // top signals that are not ports posing as ports
 					if ( ! myCheckTopPort && *instanceId_pit == 0 && myNetId < topCircuit_p->portCount ) continue; // top signals that should be ports
 					myNetIdList_p->push_front(myNetId);
@@ -1039,7 +1182,6 @@ returnCode_t CCvcDb::SetModePower() {
 			}
 			if ( ! myOtherPower_p ) {
 				netVoltagePtr_v[*netId_pit].full = myPower_p;
-				netVoltagePtr_v.powerPtrType_v[*netId_pit] = FULL_POWER_PTR;
 			}
 			if ( myPower_p->minVoltage != UNKNOWN_VOLTAGE ) netStatus_v[*netId_pit][MIN_POWER] = true;
 			if ( myPower_p->maxVoltage != UNKNOWN_VOLTAGE ) netStatus_v[*netId_pit][MAX_POWER] = true;
@@ -1364,11 +1506,14 @@ bool CCvcDb::IsSCRCPower(CPower * thePower_p) {
 
 #define MAX_LATCH_DEVICE_COUNT 6
 
-bool CCvcDb::SetLatchPower(int thePassCount, vector<bool> & theIgnoreNet_v, CNetIdSet & theNewNetSet) {
+bool CCvcDb::SetLatchPower(int thePassCount, CBitVector & theIgnoreNet_v, CNetIdSet & theNewNetSet) {
 	int myLatchCount = 0;
 	theNewNetSet.clear();
 	for (unsigned int net_it = 0; net_it < simNet_v.size(); net_it++) {
-		if ( thePassCount == 1 ) {
+		if ( thePassCount > 1 ) {  // skip to next candidate a word at a time
+			net_it = theIgnoreNet_v.FindNext(net_it, false);
+			if ( net_it >= simNet_v.size() ) break;
+		} else {
 			if ( net_it != GetEquivalentNet(net_it)  // ignore shorted nets
 					|| connectionCount_v[net_it].sourceDrainType != NMOS_PMOS  // not an output net
 					|| connectionCount_v[net_it].SourceDrainCount() > MAX_LATCH_DEVICE_COUNT ) {  // only simple connections
@@ -1551,13 +1696,13 @@ void CCvcDb::PrintInputNetsWithMinMaxSuggestions(netId_t theNetId) {
 	for ( deviceId_t device_it = firstGate_v[theNetId]; device_it != UNKNOWN_DEVICE && mySearchingFlag; device_it = nextGate_v[device_it] ) {
 		if ( IsNmos_(deviceType_v[device_it]) && ! myLowPower_p && sourceNet_v[device_it] != UNKNOWN_NET ) {
 			netId_t mySourceId = minNet_v[GetEquivalentNet(sourceNet_v[device_it])].finalNetId;
-			if ( netVoltagePtr_v.powerPtrType_v[mySourceId] == FULL_POWER_PTR ) {
+			if ( ! IsCalculatedVoltage_(netVoltagePtr_v[mySourceId].full) ) {  // only defined power
 				myLowPower_p = netVoltagePtr_v[mySourceId].full;
 			}
 		} else if ( IsPmos_(deviceType_v[device_it]) && ! myHighPower_p && drainNet_v[device_it] != UNKNOWN_NET ) {
 			netId_t mySourceId = maxNet_v[GetEquivalentNet(sourceNet_v[device_it])].finalNetId;
-			if ( netVoltagePtr_v.powerPtrType_v[mySourceId] == FULL_POWER_PTR ) {
-			myHighPower_p = netVoltagePtr_v[mySourceId].full;
+			if ( ! IsCalculatedVoltage_(netVoltagePtr_v[mySourceId].full) ) {  // only defined power
+				myHighPower_p = netVoltagePtr_v[mySourceId].full;
 			}
 		}
 		mySearchingFlag = ( myLowPower_p == NULL || myHighPower_p == NULL );
@@ -1674,6 +1819,7 @@ void CCvcDb::PrintNetSuggestions() {
 }
 
 returnCode_t CCvcDb::LoadCellErrorLimits() {
+	errorSuppressedInstance_v.clear();
 	if ( IsEmpty(cvcParameters.cvcCellErrorLimitFile) ) return OK;
 	igzstream myCellErrorLimitFile;
 	myCellErrorLimitFile.open(cvcParameters.cvcCellErrorLimitFile);
@@ -1685,6 +1831,7 @@ returnCode_t CCvcDb::LoadCellErrorLimits() {
 
 	reportFile << "CVC: Reading cell error limit settings..." << endl;
 	string myCellName;
+	deviceId_t myErrorLimitCount = 0;
 	try {
 		while ( getline(myCellErrorLimitFile, myInput) ) {
 			int myCellNameStart = myInput.find_first_not_of(" \t\n");
@@ -1693,6 +1840,9 @@ returnCode_t CCvcDb::LoadCellErrorLimits() {
 			int myErrorLimit = from_string<int>(myInput.substr(myCellNameEnd));
 			CCircuit * theMaster_p = cvcCircuitList.FindCircuit(myCellName);
 			theMaster_p->errorLimit = myErrorLimit;
+			if ( theMaster_p->errorLimitId == UNKNOWN_DEVICE ) {
+				theMaster_p->errorLimitId = myErrorLimitCount++;
+			}
 			reportFile << "INFO: error limit for " << myCellName << " is " << myErrorLimit << endl;
 		}
 	}
@@ -1701,6 +1851,17 @@ returnCode_t CCvcDb::LoadCellErrorLimits() {
 		return FAIL;
 	}
 	myCellErrorLimitFile.close();
+	// errors in instances whose nearest limited ancestor (excluding top) has limit 0 are never counted or printed.
+	// parent instance ids are always less than child ids.
+	errorSuppressedInstance_v.resize(instancePtr_v.size(), false);
+	for ( instanceId_t instance_it = 1; instance_it < instancePtr_v.size(); instance_it++ ) {
+		deviceId_t myLimit = instancePtr_v[instance_it]->master_p->errorLimit;
+		if ( myLimit == UNKNOWN_DEVICE ) {
+			errorSuppressedInstance_v[instance_it] = errorSuppressedInstance_v[instancePtr_v[instance_it]->parentId];
+		} else {
+			errorSuppressedInstance_v[instance_it] = ( myLimit == 0 );
+		}
+	}
 	return OK;
 }
 
@@ -104,9 +104,10 @@ void CCvcDb::FindInstances(string theSubcircuit, bool thePrintCircuitFlag) {
 			regex mySearchPattern(FuzzyFilter(theSubcircuit));
 			mySearchList.reserve(cvcParameters.cvcSearchLimit);
 			for( auto circuit_ppit = cvcCircuitList.begin(); circuit_ppit != cvcCircuitList.end(); circuit_ppit++) {
-				if ( regex_match((*circuit_ppit)->name, mySearchPattern) ) {
+				if ( (*circuit_ppit)->NameMatch(mySearchPattern) ) {
 					if ( myMatchCount++ < cvcParameters.cvcSearchLimit ) {
-						mySearchList.push_back(string((*circuit_ppit)->name) + " #instances: " + to_string<uintmax_t>((*circuit_ppit)->instanceCount));
+						mySearchList.push_back(string((*circuit_ppit)->name) + " #instances: " + to_string<uintmax_t>((*circuit_ppit)->instanceCount)
+							+ ( (*circuit_ppit)->alias_v.empty() ? "" : " #aliases: " + to_string<uintmax_t>((*circuit_ppit)->alias_v.size()) ));
 					}
 				}
 			}
@@ -148,7 +149,7 @@ void CCvcDb::ShowNets(size_t & theNetCount, regex & theSearchPattern, instanceId
 		if ( regex_match(signalMap_pit->first, theSearchPattern) ) {
 			if ( theNetCount++ < cvcParameters.cvcSearchLimit ) {
 				string myLowerNet = HierarchyName(theInstanceId, thePrintCircuitFlag) + "/" + signalMap_pit->first;
-				netId_t myNetId = myInstance_p->localToGlobalNetId_v[signalMap_pit->second];
+				netId_t myNetId = myInstance_p->LocalToGlobalNetId(signalMap_pit->second);
 				netId_t myEquivalentNetId = (isFixedEquivalentNet) ? GetEquivalentNet(myNetId) : myNetId;
 				string myTopNet = NetName(myEquivalentNetId, thePrintCircuitFlag);
 				reportFile << myLowerNet;
@@ -180,16 +181,19 @@ void CCvcDb::PrintSubcircuitCdl(string theSubcircuit) {
 	if ( myCircuit == NULL ) return;
 
 	string myFileName = theSubcircuit + ".cdl";
-	ofstream myCdlFile(myFileName);
-	if (myCdlFile.fail()) {
+	CCdlWriter myCdlFile;
+	if ( ! myCdlFile.Open(myFileName) ) {
 		reportFile << "Could not open " << myFileName << endl;
 		return;
 	}
-	unordered_set<text_t> myPrintedList;
+	unordered_set<CCircuit *> myPrintedList;
 	PrintHierarchicalCdl(myCircuit, myPrintedList, myCdlFile);
-	myCdlFile << endl;
-	reportFile << "Wrote subcircuit " << theSubcircuit << " to " << theSubcircuit << ".cdl" << endl;
-	myCdlFile.close();
+	myCdlFile.EndLine();
+	if ( ! myCdlFile.Close() ) {
+		reportFile << "ERROR: Could not write " << myFileName << endl;
+		return;
+	}
+	reportFile << "Wrote subcircuit " << theSubcircuit << " to " << myFileName << endl;
 }
 
 instanceId_t CCvcDb::FindHierarchy(instanceId_t theCurrentInstanceId, string theHierarchy, bool theAllowPartialMatch, bool thePrintUnmatchFlag) {
@@ -316,7 +320,7 @@ void CCvcDb::PrintNets(instanceId_t theCurrentInstanceId, string theFilter, bool
 				myMatchCount = 0;
 				mySearchList.clear();
 			}
-			myGlobalNetId = instancePtr_v[theCurrentInstanceId]->localToGlobalNetId_v[net_it];
+			myGlobalNetId = instancePtr_v[theCurrentInstanceId]->LocalToGlobalNetId(net_it);
 			string	myGlobalNet = "";
 			if ( thePrintSubcircuitNameFlag ) {
 				myGlobalNet = "(";
@@ -484,7 +488,7 @@ netId_t CCvcDb::FindNet(instanceId_t theCurrentInstanceId, string theNetName, bo
 		CCircuit * myCircuit_p = instancePtr_v[myCurrentInstanceId]->master_p;
 		string myParentName = HierarchyName(myCurrentInstanceId, false) + HIERARCHY_DELIMITER;
 		myNetName = theNetName.substr(myParentName.length() - myInitialHierarchy.length());
-		return instancePtr_v[myCurrentInstanceId]->localToGlobalNetId_v[myCircuit_p->localSignalIdMap.at(cvcCircuitList.cdlText.GetTextAddress(myNetName))];
+		return instancePtr_v[myCurrentInstanceId]->LocalToGlobalNetId(myCircuit_p->localSignalIdMap.at(cvcCircuitList.cdlText.GetTextAddress(myNetName)));
 	}
 	catch (const out_of_range& oor_exception) {
 		if ( theDisplayErrorFlag ) {
@@ -668,6 +672,7 @@ returnCode_t CCvcDb::InteractiveCvc(int theCurrentStage) {
 				cout << "findsubcircuit<fs> subcircuit: list all instances of subcircuit or if regex, subcircuits that match" << endl;
 				cout << "findnet<fn> net: list all nets that match in lower subcircuits." << endl;
 				cout << "printcdl<pc> subcircuit: print subcircuit as subcircuit.cdl" << endl;
+				cout << "printflatcdl<pfc> filename: print flattened top circuit to filename (compressed if filename ends in .gz)" << endl;
 				cout << "printenvironment<pe>: print simulation environment" << endl;
 				cout << "togglename<n>: toggle subcircuit names" << endl;
 //				cout << "shortfile<s> file: use file as shorts" << endl;
@@ -789,6 +794,14 @@ returnCode_t CCvcDb::InteractiveCvc(int theCurrentStage) {
 				mySubcircuit = "";
 				myInputStream >> mySubcircuit;
 				PrintSubcircuitCdl(mySubcircuit);
+			} else if ( myCommand == "printflatcdl" || myCommand == "pfc" ) {
+				if ( myInputStream >> myFileName ) {
+					if ( PrintFlatCdl(myFileName) == OK ) {
+						reportFile << "Wrote flat netlist to " << myFileName << endl;
+					}
+				} else {
+					reportFile << "ERROR: no flat cdl file name" << endl;
+				}
 			} else if ( myCommand == "printenvironment" || myCommand == "pe" ) {
 				cvcParameters.PrintEnvironment(reportFile);
 			} else if ( myCommand == "listnet" || myCommand == "ln" ) {
@@ -1170,7 +1183,7 @@ void CCvcDb::DumpUnknownLogicalPorts(instanceId_t theCurrentInstanceId, string t
 			netId_t net_it = signalMap_pit->second;
 			if ( net_it >= myCircuit_p->portCount && instance_it != theCurrentInstanceId ) continue;  // skip internal signals in subcircuits
 			list<tuple<instanceId_t, netId_t, netId_t>> myNetStack;
-			netId_t myTopNetId = GetEquivalentNet(myInstance_p->localToGlobalNetId_v[net_it]);
+			netId_t myTopNetId = GetEquivalentNet(myInstance_p->LocalToGlobalNetId(net_it));
 			if ( myPrintedNets.count(myTopNetId) > 0 ) continue;  // ignore already printed
 			if ( ! myIsLogicalNet_v[myTopNetId] ) continue;  // ignore analog nets and known logic
 			if ( ! regex_match(signalMap_pit->first, mySearchPattern) ) continue;  // ignore non-match
@@ -1517,6 +1530,9 @@ void CCvcDb::CreateDebugCvcrcFile(ofstream & theOutputFile, instanceId_t theInst
 	theOutputFile << "CVC_LEAK_OVERVOLTAGE = '" << (( cvcParameters.cvcLeakOvervoltage ) ? "true" : "false") << "'" << endl;
 	theOutputFile << "CVC_LOGIC_DIODES = '" << (( cvcParameters.cvcLogicDiodes ) ? "true" : "false") << "'" << endl;
 	theOutputFile << "CVC_ANALOG_GATES = '" << (( cvcParameters.cvcAnalogGates ) ? "true" : "false") << "'" << endl;
+	theOutputFile << "CVC_MERGE_PARALLEL_FINGERS = '" << (( cvcParameters.cvcMergeParallelFingers ) ? "true" : "false") << "'" << endl;
+	theOutputFile << "CVC_COMPACT_PARENT_INDEX = '" << (( cvcParameters.cvcCompactParentIndex ) ? "true" : "false") << "'" << endl;
+	theOutputFile << "CVC_MERGE_IDENTICAL_CIRCUITS = '" << (( cvcParameters.cvcMergeIdenticalCircuits ) ? "true" : "false") << "'" << endl;
 	theOutputFile << "CVC_MOS_DIODE_ERROR_THRESHOLD = '" << Voltage_to_float(cvcParameters.cvcMosDiodeErrorThreshold) << "'" << endl;
 	theOutputFile << "CVC_SHORT_ERROR_THRESHOLD = '" << Voltage_to_float(cvcParameters.cvcShortErrorThreshold) << "'" << endl;
 	theOutputFile << "CVC_BIAS_ERROR_THRESHOLD = '" << Voltage_to_float(cvcParameters.cvcBiasErrorThreshold) << "'" << endl;
@@ -1564,7 +1580,7 @@ void CCvcDb::PrintInstancePowerFile(instanceId_t theInstanceId, string thePowerF
 		}
 	}
 	for ( netId_t net_it = 0; net_it < myInstance_p->master_p->portCount; net_it++ ) {
-		netId_t myGlobalNetId = GetEquivalentNet(myInstance_p->localToGlobalNetId_v[net_it]);
+		netId_t myGlobalNetId = GetEquivalentNet(myInstance_p->LocalToGlobalNetId(net_it));
 		CPower * myPower_p = netVoltagePtr_v[myGlobalNetId].full;
 		if ( myPower_p && ! IsEmpty(myPower_p->powerSignal()) ) {
 			string myDefinition = string(myPower_p->definition).substr(0, string(myPower_p->definition).find(" calculation=>"));
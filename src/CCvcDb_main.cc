@@ -41,10 +41,6 @@ int gContinueCount = 0; //!< number of stages to run before stopping; always sto
 
 rusage lastSnapshot; //!< resource usage tracking
 
-// debugging variables for virtual net updates
-long gVirtualNetAccessCount = 0;
-long gVirtualNetUpdateCount = 0;
-
 /**
  * \brief Main Loop: Verify circuits using settings in each verification resource file.
  *
@@ -197,18 +193,7 @@ void CCvcDb::VerifyCircuitForAllModes(int argc, const char * argv[]) {
 			if ( ! cvcParameters.cvcLogicDiodes ) {
 				FindForwardBiasDiodes();
 			}
-			if ( ! cvcParameters.cvcSOI ) {
-				FindNmosSourceVsBulkErrors();
-			}
-			if ( ! gSetup_cvc ) {
-				FindNmosGateVsSourceErrors();
-			}
-			if ( ! cvcParameters.cvcSOI ) {
-				FindPmosSourceVsBulkErrors();
-			}
-			if ( ! gSetup_cvc ) {
-				FindPmosGateVsSourceErrors();
-			}
+			FindMosBiasAndGateErrors();
 			reportFile << PrintProgress(&lastSnapshot, "ERROR") << endl;
 		}
 		if ( gInteractive_cvc && --gContinueCount < 1
@@ -242,7 +227,7 @@ void CCvcDb::VerifyCircuitForAllModes(int argc, const char * argv[]) {
 		reportFile << PrintProgress(&lastSnapshot, "SIM2") << endl;
 		reportFile << "Power nets " << CPower::powerCount << endl;
 		CNetIdSet myNewNetSet;
-		vector<bool> myIgnoreNet_v(simNet_v.size(), false);
+		CBitVector myIgnoreNet_v(simNet_v.size(), false);
 		int myPassCount = 0;
 		while ( SetLatchPower(++myPassCount, myIgnoreNet_v, myNewNetSet) ) {
 			SetSimPower(ALL_NETS_AND_FUSE, myNewNetSet);
@@ -271,8 +256,7 @@ void CCvcDb::VerifyCircuitForAllModes(int argc, const char * argv[]) {
 				FindForwardBiasDiodes();
 			}
 			FindAllOverVoltageErrors();
-			FindNmosPossibleLeakErrors();
-			FindPmosPossibleLeakErrors();
+			FindMosPossibleLeakErrors();
 			FindFloatingInputErrors();
 			CheckExpectedValues();
 		}
@@ -286,8 +270,8 @@ void CCvcDb::VerifyCircuitForAllModes(int argc, const char * argv[]) {
 			Print("", "CVC Database");
 			PrintFlatCdl();
 		}
-		reportFile << "Virtual net update/access " << gVirtualNetUpdateCount << "/"
-				<< gVirtualNetAccessCount << endl;
+		reportFile << "Virtual net update/access " << minNet_v.updateCount + simNet_v.updateCount + maxNet_v.updateCount << "/"
+				<< minNet_v.accessCount + simNet_v.accessCount + maxNet_v.accessCount << endl;
 		reportFile << "CVC: Log output to " << cvcParameters.cvcReportFilename << endl;
 		reportFile << "CVC: End: " << CurrentTime() << endl;
 		errorFile.close();
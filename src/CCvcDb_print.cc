@@ -218,127 +218,129 @@ void CCvcDb::PrintInverterNets(string theIndentation) {
 	cout << theIndentation << "InverterNets> end" << endl;
 }
 
-void CCvcDb::PrintFlatCdl() {
-	PrintNewCdlLine(string(".SUBCKT"));
-	PrintCdlLine(topCircuit_p->name);
+const string & CCvcDb::CdlHierarchyPrefix(instanceId_t theInstanceId, vector<pair<instanceId_t, string>> & thePrefixCache) {
+	// direct mapped cache of "/a/b/" prefixes. parents are computed recursively through the cache.
+	pair<instanceId_t, string> & myEntry = thePrefixCache[theInstanceId % thePrefixCache.size()];
+	if ( myEntry.first == theInstanceId ) return myEntry.second;
+	string myPrefix;
+	if ( theInstanceId == 0 ) {
+		myPrefix = "/";
+	} else {
+		instanceId_t myParentId = instancePtr_v[theInstanceId]->parentId;
+		instanceId_t mySubcircuitOffset = theInstanceId - instancePtr_v[myParentId]->firstSubcircuitId;
+		myPrefix = CdlHierarchyPrefix(myParentId, thePrefixCache);
+		myPrefix += instancePtr_v[myParentId]->master_p->subcircuitPtr_v[mySubcircuitOffset]->name;
+		myPrefix += "/";
+	}
+	myEntry.first = theInstanceId;
+	myEntry.second.swap(myPrefix);
+	return myEntry.second;
+}
+
+returnCode_t CCvcDb::PrintFlatCdl(string theFileName) {
+	CCdlWriter myWriter;
+	if ( theFileName.empty() ) {
+		myWriter.Open(cout);
+	} else if ( ! myWriter.Open(theFileName) ) {
+		reportFile << "ERROR: Could not open " << theFileName << endl;
+		return (FAIL);
+	}
+	myWriter.NewLine(".SUBCKT");
+	myWriter.Add(topCircuit_p->name);
 	for (netId_t net_it = 0; net_it < topCircuit_p->portCount; net_it++) {
-		PrintCdlLine(topCircuit_p->internalSignal_v[net_it]);
+		myWriter.Add(topCircuit_p->internalSignal_v[net_it]);
 	}
 
+	vector<pair<instanceId_t, string>> myPrefixCache(4096, make_pair(UNKNOWN_INSTANCE, string()));
+	string myDevicePrefix;
+	string myNetPrefix;
+	string myMultiplier;
+	char myType[2] = {0, 0};
 	CCircuit * myMaster_p;
 	for (instanceId_t instance_it = 0; instance_it < instancePtr_v.size(); instance_it++) {
-		if ( instancePtr_v[instance_it]->IsParallelInstance() ) continue;
-		myMaster_p = instancePtr_v[instance_it]->master_p;
+		CInstance * myInstance_p = instancePtr_v[instance_it];
+		if ( myInstance_p->IsParallelInstance() ) continue;
+		myMaster_p = myInstance_p->master_p;
+		if ( myMaster_p->devicePtr_v.empty() ) continue;
+		myDevicePrefix = CdlHierarchyPrefix(instance_it, myPrefixCache);
+		myMultiplier = ( myInstance_p->parallelInstanceCount > 1 ) ? "M=" + to_string<instanceId_t>(myInstance_p->parallelInstanceCount) : "";
 		for (deviceId_t device_it = 0; device_it < myMaster_p->devicePtr_v.size(); device_it++) {
-			PrintNewCdlLine(myMaster_p->devicePtr_v[device_it]->parameters[0] + DeviceName(instancePtr_v[instance_it]->firstDeviceId + device_it, PRINT_CIRCUIT_OFF));
-			for (netId_t net_it = 0; net_it < myMaster_p->devicePtr_v[device_it]->signalId_v.size(); net_it++) {
-				PrintCdlLine(NetName(instancePtr_v[instance_it]->localToGlobalNetId_v[myMaster_p->devicePtr_v[device_it]->signalId_v[net_it]]));
+			CDevice * myDevice_p = myMaster_p->devicePtr_v[device_it];
+			myType[0] = myDevice_p->parameters[0];
+			myWriter.NewLine(myType, 1);
+			myWriter.Continue(myDevicePrefix.data(), myDevicePrefix.length());
+			myWriter.Continue(myDevice_p->name, strlen(myDevice_p->name));
+			for (netId_t net_it = 0; net_it < myDevice_p->signalId_v.size(); net_it++) {
+				netId_t myNetId = myInstance_p->LocalToGlobalNetId(myDevice_p->signalId_v[net_it]);
+				instanceId_t myParentId = netParent_v[myNetId];
+				CCircuit * myParentMaster_p = instancePtr_v[myParentId]->master_p;
+				if ( myParentId == 0 && myNetId < myParentMaster_p->portCount ) {
+					myWriter.Add(myParentMaster_p->internalSignal_v[myNetId]);
+				} else {
+					myWriter.Add(( myParentId == instance_it ) ? myDevicePrefix : CdlHierarchyPrefix(myParentId, myPrefixCache),
+						myParentMaster_p->internalSignal_v[myNetId - instancePtr_v[myParentId]->firstNetId]);
+				}
 			}
-			PrintCdlLine(myMaster_p->devicePtr_v[device_it]->parameters + 2);  // skip first 2 characters of parameter string
-			if ( instancePtr_v[instance_it]->parallelInstanceCount > 1 ) {
-				PrintCdlLine("M=" + to_string<instanceId_t> (instancePtr_v[instance_it]->parallelInstanceCount));
+			myWriter.Add(myDevice_p->parameters + 2);  // skip first 2 characters of parameter string
+			if ( ! myMultiplier.empty() ) {
+				myWriter.Add(myMultiplier);
 			}
-			PrintCdlLine(string(""));
 		}
 	}
-	PrintNewCdlLine(string(".ENDS"));
-	PrintNewCdlLine(string(""));
+	myWriter.NewLine(".ENDS");
+	myWriter.EndLine();
+	if ( ! myWriter.Close() ) {
+		reportFile << "ERROR: Could not write " << ( theFileName.empty() ? "flat netlist" : theFileName ) << endl;
+		return (FAIL);
+	}
+	return (OK);
 }
 
-void CCvcDb::PrintHierarchicalCdl(CCircuit *theCircuit, unordered_set<text_t> & thePrintedList, ostream & theCdlFile) {
+void CCvcDb::PrintHierarchicalCdl(CCircuit *theCircuit, unordered_set<CCircuit *> & thePrintedList, CCdlWriter & theWriter) {
 	for (instanceId_t instance_it = 0; instance_it < theCircuit->subcircuitPtr_v.size(); instance_it++) {
 		CCircuit * myMaster_p = theCircuit->subcircuitPtr_v[instance_it]->master_p;
-		if (thePrintedList.count(myMaster_p->name) == 0) {
-			thePrintedList.insert(myMaster_p->name);
-			PrintHierarchicalCdl(myMaster_p, thePrintedList, theCdlFile);
+		if ( thePrintedList.insert(myMaster_p).second ) {
+			PrintHierarchicalCdl(myMaster_p, thePrintedList, theWriter);
 		}
 	}
 
-	PrintNewCdlLine(string(".SUBCKT"), theCdlFile);
-	PrintCdlLine(theCircuit->name, theCdlFile);
+	theWriter.NewLine(".SUBCKT");
+	theWriter.Add(theCircuit->name);
 	vector<text_t> mySignals_v;
-	mySignals_v.reserve(theCircuit->localSignalIdMap.size());
-	for (auto signal_net_pair_pit = theCircuit->localSignalIdMap.begin(); signal_net_pair_pit != theCircuit->localSignalIdMap.end(); signal_net_pair_pit++) {
-		mySignals_v[signal_net_pair_pit->second] = signal_net_pair_pit->first;
+	if ( theCircuit->internalSignal_v.size() == theCircuit->localSignalIdMap.size() ) {
+		mySignals_v = theCircuit->internalSignal_v;
+	} else {
+		mySignals_v.resize(theCircuit->localSignalIdMap.size());
+		for (auto signal_net_pair_pit = theCircuit->localSignalIdMap.begin(); signal_net_pair_pit != theCircuit->localSignalIdMap.end(); signal_net_pair_pit++) {
+			mySignals_v[signal_net_pair_pit->second] = signal_net_pair_pit->first;
+		}
 	}
 	for (netId_t net_it = 0; net_it < theCircuit->portCount; net_it++) {
-		PrintCdlLine(mySignals_v[net_it], theCdlFile);
+		theWriter.Add(mySignals_v[net_it]);
 	}
 	for (deviceId_t device_it = 0; device_it < theCircuit->devicePtr_v.size(); device_it++) {
-		PrintNewCdlLine(theCircuit->devicePtr_v[device_it]->name, theCdlFile);
-		string myDeviceType = theCircuit->devicePtr_v[device_it]->model_p->baseType;
-		if ( myDeviceType == "R" || myDeviceType == "C" ) {
-			for (netId_t net_it = 0; net_it < 2; net_it++) {
-				PrintCdlLine(mySignals_v[theCircuit->devicePtr_v[device_it]->signalId_v[net_it]], theCdlFile);
-			}
-		} else {
-			for (netId_t net_it = 0; net_it < theCircuit->devicePtr_v[device_it]->signalId_v.size(); net_it++) {
-				PrintCdlLine(mySignals_v[theCircuit->devicePtr_v[device_it]->signalId_v[net_it]], theCdlFile);
-			}
-		}
-		PrintCdlLine(theCircuit->devicePtr_v[device_it]->parameters + 2, theCdlFile);  // The first 2 characters of the parameters are device type code. ignore them.
-/*
-		if ( theCircuit->devicePtr_v[device_it]->model_p->type == NRESISTOR || theCircuit->devicePtr_v[device_it]->model_p->type == PRESISTOR ) {
-			PrintCdlLine(string("$SUB=") + mySignals_v[theCircuit->devicePtr_v[device_it]->signalId_v[2]], theCdlFile);
+		CDevice * myDevice_p = theCircuit->devicePtr_v[device_it];
+		theWriter.NewLine(myDevice_p->name);
+		bool myIsResistorCapacitor = ( myDevice_p->model_p->baseType == "R" || myDevice_p->model_p->baseType == "C" );
+		netId_t mySignalCount = ( myIsResistorCapacitor ) ? 2 : myDevice_p->signalId_v.size();
+		for (netId_t net_it = 0; net_it < mySignalCount; net_it++) {
+			theWriter.Add(mySignals_v[myDevice_p->signalId_v[net_it]]);
 		}
-*/
-		if ( (myDeviceType == "R" || myDeviceType == "C") && theCircuit->devicePtr_v[device_it]->signalId_v.size() == 3 ) {
-			PrintCdlLine(string("$SUB=") + mySignals_v[theCircuit->devicePtr_v[device_it]->signalId_v[2]], theCdlFile);
+		theWriter.Add(myDevice_p->parameters + 2);  // The first 2 characters of the parameters are device type code. ignore them.
+		if ( myIsResistorCapacitor && myDevice_p->signalId_v.size() == 3 ) {
+			theWriter.Add("$SUB=", mySignals_v[myDevice_p->signalId_v[2]]);
 		}
-		PrintCdlLine(string(""), theCdlFile);
 	}
 	for (instanceId_t instance_it = 0; instance_it < theCircuit->subcircuitPtr_v.size(); instance_it++) {
-		PrintNewCdlLine(theCircuit->subcircuitPtr_v[instance_it]->name, theCdlFile);
-		for (netId_t net_it = 0; net_it < theCircuit->subcircuitPtr_v[instance_it]->signalId_v.size(); net_it++) {
-			PrintCdlLine(mySignals_v[theCircuit->subcircuitPtr_v[instance_it]->signalId_v[net_it]], theCdlFile);
+		CDevice * mySubcircuit_p = theCircuit->subcircuitPtr_v[instance_it];
+		theWriter.NewLine(mySubcircuit_p->name);
+		for (netId_t net_it = 0; net_it < mySubcircuit_p->signalId_v.size(); net_it++) {
+			theWriter.Add(mySignals_v[mySubcircuit_p->signalId_v[net_it]]);
 		}
-		PrintCdlLine(theCircuit->subcircuitPtr_v[instance_it]->masterName, theCdlFile);
-		PrintCdlLine(string(""), theCdlFile);
-	}
-	PrintNewCdlLine(string(".ENDS"), theCdlFile);
-	PrintNewCdlLine(string(" "), theCdlFile);
-}
-
-void CCvcDb::PrintCdlLine(const string theData, ostream & theOutput, const unsigned int theMaxLength) {
-	if (lineLength + theData.length() > theMaxLength) {
-		theOutput << endl << "+";
-		lineLength = 1;
-	}
-	theOutput << " " << theData;
-	lineLength += theData.length() + 1;
-}
-
-void CCvcDb::PrintNewCdlLine(const string theData, ostream & theOutput) {
-	if ( lineLength > 0) {
-		theOutput << endl;
-	}
-	theOutput << theData;
-	lineLength = theData.length();
-}
-
-void CCvcDb::PrintCdlLine(const char * theData, ostream & theOutput, const unsigned int theMaxLength) {
-	if (lineLength + strlen(theData) > theMaxLength) {
-		theOutput << endl << "+";
-		lineLength = 1;
-	}
-	theOutput << " " << theData;
-	lineLength += strlen(theData);
-}
-
-void CCvcDb::PrintNewCdlLine(const text_t theData, ostream & theOutput) {
-	if ( lineLength > 0) {
-		theOutput << endl;
-	}
-	theOutput << theData;
-	lineLength = strlen(theData);
-}
-
-void CCvcDb::PrintNewCdlLine(const char theData, ostream & theOutput) {
-	if ( lineLength > 0) {
-		theOutput << endl;
+		theWriter.Add(mySubcircuit_p->masterName);
 	}
-	theOutput << theData;
-	lineLength = 1;
+	theWriter.NewLine(".ENDS");
+	theWriter.NewLine(" ");
 }
 
 void CCvcDb::PrintSourceDrainConnections(CStatus& theConnectionStatus, string theIndentation) {
@@ -528,7 +530,8 @@ void CCvcDb::PrintVirtualNets(CVirtualNetVector& theVirtualNet_v, string theTitl
 }
 
 void CCvcDb::PrintDeviceWithAllConnections(instanceId_t theParentId, CFullConnection& theConnections, ogzstream& theErrorFile, bool theIncludeLeakVoltage) {
-	int myMFactor = CalculateMFactor(theParentId);
+	ResolveConnections(theConnections);  // connections may have been partially mapped
+	int myMFactor = CalculateMFactor(theParentId) * theConnections.device_p->fingerCount;
 	theErrorFile << DeviceName(theConnections.device_p->name, theParentId, PRINT_CIRCUIT_ON) << " " << theConnections.device_p->parameters;
 	if ( myMFactor > 1 ) theErrorFile << " {m=" << myMFactor << "}";
 	theErrorFile << " (r=" << parameterResistanceMap[theConnections.device_p->parameters] << ")" << endl;
@@ -558,7 +561,7 @@ void CCvcDb::PrintDeviceWithAllConnections(instanceId_t theParentId, CFullConnec
 }
 
 void CCvcDb::PrintDeviceWithSimConnections(instanceId_t theParentId, CFullConnection& theConnections, ogzstream& theErrorFile) {
-	int myMFactor = CalculateMFactor(theParentId);
+	int myMFactor = CalculateMFactor(theParentId) * theConnections.device_p->fingerCount;
 	theErrorFile << DeviceName(theConnections.device_p->name, theParentId, PRINT_CIRCUIT_ON) << " " << theConnections.device_p->parameters;
 	if ( myMFactor > 1 ) theErrorFile << " {m=" << myMFactor << "}";
 	theErrorFile << " (r=" << parameterResistanceMap[theConnections.device_p->parameters] << ")" << endl;
@@ -897,6 +900,7 @@ void CCvcDb::PrintClassSizes() {
 	cout << "CModelList " << sizeof(class CModelList) << endl;
 	cout << "CModelListMap " << sizeof(class CModelListMap) << endl;
 	cout << "CNetIdVector " << sizeof(class CNetIdVector) << endl;
+	cout << "CNetIdSpan " << sizeof(class CNetIdSpan) << endl;
 	cout << "CNetList " << sizeof(class CNetList) << endl;
 	cout << "CNetMap " << sizeof(class CNetMap) << endl;
 	cout << "CNormalValue " << sizeof(class CNormalValue) << endl;
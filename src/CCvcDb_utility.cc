@@ -49,7 +49,7 @@
 
 voltage_t CCvcDb::MinVoltage(netId_t theNetId, bool theSkipHiZFlag) {
 	if ( theNetId != UNKNOWN_NET ) {
-		static CVirtualNet myVirtualNet;
+		CVirtualNet myVirtualNet;
 		assert(theNetId == GetEquivalentNet(theNetId));
 		myVirtualNet(minNet_v, theNetId);
 		if ( myVirtualNet.finalNetId != UNKNOWN_NET ) {
@@ -66,7 +66,7 @@ voltage_t CCvcDb::MinVoltage(netId_t theNetId, bool theSkipHiZFlag) {
 voltage_t CCvcDb::MinSimVoltage(netId_t theNetId) {
 	// limit min value to calculated sim value
 	if ( theNetId != UNKNOWN_NET ) {
-		static CVirtualNet myVirtualNet;
+		CVirtualNet myVirtualNet;
 		assert(theNetId == GetEquivalentNet(theNetId));
 		myVirtualNet(minNet_v, theNetId);
 		if ( myVirtualNet.finalNetId != UNKNOWN_NET ) {
@@ -88,7 +88,7 @@ voltage_t CCvcDb::MinSimVoltage(netId_t theNetId) {
 resistance_t CCvcDb::MinResistance(netId_t theNetId) {
 	// resistance to minimum master net
 	if ( theNetId != UNKNOWN_NET ) {
-		static CVirtualNet myVirtualNet;
+		CVirtualNet myVirtualNet;
 		assert(theNetId == GetEquivalentNet(theNetId));
 		myVirtualNet(minNet_v, theNetId);
 		if ( myVirtualNet.finalNetId != UNKNOWN_NET ) {
@@ -117,7 +117,7 @@ voltage_t CCvcDb::MinLeakVoltage(netId_t theNetId) {
 
 voltage_t CCvcDb::SimVoltage(netId_t theNetId) {
 	if ( theNetId != UNKNOWN_NET ) {
-		static CVirtualNet myVirtualNet;
+		CVirtualNet myVirtualNet;
 		assert(theNetId == GetEquivalentNet(theNetId));
 		myVirtualNet(simNet_v, theNetId);
 		if ( myVirtualNet.finalNetId != UNKNOWN_NET ) {
@@ -132,10 +132,10 @@ voltage_t CCvcDb::SimVoltage(netId_t theNetId) {
 
 bool CCvcDb::IsAlwaysOnCandidate(deviceId_t theDeviceId, shortDirection_t theDirection) {
 	if ( theDeviceId == UNKNOWN_DEVICE ) return false;
-	static CVirtualNet myMinVirtualSourceNet;
-	static CVirtualNet myMinVirtualDrainNet;
-	static CVirtualNet myMaxVirtualSourceNet;
-	static CVirtualNet myMaxVirtualDrainNet;
+	CVirtualNet myMinVirtualSourceNet;
+	CVirtualNet myMinVirtualDrainNet;
+	CVirtualNet myMaxVirtualSourceNet;
+	CVirtualNet myMaxVirtualDrainNet;
 	netId_t mySourceNetId = GetEquivalentNet(sourceNet_v[theDeviceId]);
 	netId_t myDrainNetId = GetEquivalentNet(drainNet_v[theDeviceId]);
 	if ( theDirection == DRAIN_TO_MASTER_SOURCE && connectionCount_v[myDrainNetId].sourceDrainType != NMOS_PMOS ) return true;  // non-output devices are always true
@@ -195,7 +195,7 @@ bool CCvcDb::IsAlwaysOnCandidate(deviceId_t theDeviceId, shortDirection_t theDir
 resistance_t CCvcDb::SimResistance(netId_t theNetId) {
 //	resistance_t myResistance;
 	if ( theNetId != UNKNOWN_NET ) {
-		static CVirtualNet myVirtualNet;
+		CVirtualNet myVirtualNet;
 		assert(theNetId == GetEquivalentNet(theNetId));
 		myVirtualNet(simNet_v, theNetId);
 		return myVirtualNet.finalResistance;
@@ -205,7 +205,7 @@ resistance_t CCvcDb::SimResistance(netId_t theNetId) {
 
 voltage_t CCvcDb::MaxVoltage(netId_t theNetId, bool theSkipHiZFlag) {
 	if ( theNetId != UNKNOWN_NET ) {
-		static CVirtualNet myVirtualNet;
+		CVirtualNet myVirtualNet;
 		assert(theNetId == GetEquivalentNet(theNetId));
 		myVirtualNet(maxNet_v, theNetId);
 		if ( myVirtualNet.finalNetId != UNKNOWN_NET ) {
@@ -222,7 +222,7 @@ voltage_t CCvcDb::MaxVoltage(netId_t theNetId, bool theSkipHiZFlag) {
 voltage_t CCvcDb::MaxSimVoltage(netId_t theNetId) {
 	// limit max value to calculated sim value
 	if ( theNetId != UNKNOWN_NET ) {
-		static CVirtualNet myVirtualNet;
+		CVirtualNet myVirtualNet;
 		assert(theNetId == GetEquivalentNet(theNetId));
 		myVirtualNet(maxNet_v, theNetId);
 		if ( myVirtualNet.finalNetId != UNKNOWN_NET ) {
@@ -244,7 +244,7 @@ voltage_t CCvcDb::MaxSimVoltage(netId_t theNetId) {
 resistance_t CCvcDb::MaxResistance(netId_t theNetId) {
 	// resistance to maximum master net
 	if ( theNetId != UNKNOWN_NET ) {
-		static CVirtualNet myVirtualNet;
+		CVirtualNet myVirtualNet;
 		assert(theNetId == GetEquivalentNet(theNetId));
 		myVirtualNet(maxNet_v, theNetId);
 		if ( myVirtualNet.finalNetId != UNKNOWN_NET ) {
@@ -280,12 +280,19 @@ netId_t CCvcDb::GetGreatestEquivalentNet(netId_t theNetId) {
 }
 
 // equivalency list is descending order loop; return node is least
+// path is compressed to point directly at the least net
 netId_t CCvcDb::GetLeastEquivalentNet(netId_t theNetId) {
 	if ( theNetId == UNKNOWN_NET ) return UNKNOWN_NET;
-	while ( equivalentNet_v[theNetId] < theNetId ) {
-		theNetId = equivalentNet_v[theNetId];
+	netId_t myLeastNetId = theNetId;
+	while ( equivalentNet_v[myLeastNetId] < myLeastNetId ) {
+		myLeastNetId = equivalentNet_v[myLeastNetId];
 	}
-	return theNetId;
+	while ( equivalentNet_v[theNetId] > myLeastNetId ) {
+		netId_t myNextNetId = equivalentNet_v[theNetId];
+		equivalentNet_v[theNetId] = myLeastNetId;
+		theNetId = myNextNetId;
+	}
+	return myLeastNetId;
 }
 
 netId_t CCvcDb::GetEquivalentNet(netId_t theNetId) {
@@ -313,38 +320,38 @@ void CCvcDb::SetDeviceNets(CInstance * theInstance_p, CDevice * theDevice_p, net
 	// sets a element in each of the sourceNet_v, gateNet_v, drainNet_v, bulkNet_v arrays
 	switch (theDevice_p->model_p->type) {
 		case NMOS: case PMOS: case LDDN: case LDDP: {
-			theDrainId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[0]]);
-			theGateId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[1]]);
-			theSourceId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[2]]);
+			theDrainId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[0]));
+			theGateId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[1]));
+			theSourceId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[2]));
 			if ( cvcParameters.cvcSOI ) {
 				theBulkId = UNKNOWN_NET;
 			} else {
-				theBulkId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[3]]);
+				theBulkId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[3]));
 			}
 		break; }
 		case DIODE: case SWITCH_OFF: case FUSE_OFF: case CAPACITOR:	case SWITCH_ON:	case FUSE_ON: case RESISTOR: {
-			theSourceId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[0]]);
+			theSourceId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[0]));
 			theGateId = UNKNOWN_NET;
-			theDrainId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[1]]);
+			theDrainId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[1]));
 			theBulkId = UNKNOWN_NET;
 			if ( theDevice_p->signalId_v.size() == 3 ) {
-				theBulkId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[2]]);
+				theBulkId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[2]));
 			} else {
 				theBulkId = UNKNOWN_NET;
 			}
 		break; }
 /*
 		case NRESISTOR: case PRESISTOR: {
-			theSourceId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[0]]);
+			theSourceId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[0]));
 			theGateId = UNKNOWN_NET;
-			theDrainId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[1]]);
-			theBulkId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[2]]);
+			theDrainId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[1]));
+			theBulkId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[2]));
 		break; }
 */
 		case BIPOLAR: /* case NPN: case PNP: */ {
-			theSourceId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[0]]);
-			theGateId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[1]]);
-			theDrainId = GetEquivalentNet(theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[2]]);
+			theSourceId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[0]));
+			theGateId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[1]));
+			theDrainId = GetEquivalentNet(theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[2]));
 			theBulkId = UNKNOWN_NET;
 		break; }
 		default: {
@@ -405,11 +412,11 @@ void CCvcDb::MapDeviceNets(deviceId_t theDeviceId, CEventQueue& theEventQueue, C
 	theConnections.resistance = parameterResistanceMap[theConnections.device_p->parameters];
 }
 
-void CCvcDb::MapDeviceNets(deviceId_t theDeviceId, CFullConnection& theConnections) {
+void CCvcDb::MapDeviceNets(deviceId_t theDeviceId, CFullConnection& theConnections, int theTerminals, int theQueues) {
 	/// Get connections for device at all sample points (min/sim/max) from deviceId
 	CInstance * myInstance_p = instancePtr_v[deviceParent_v[theDeviceId]];
 	CDevice * myDevice_p = myInstance_p->master_p->devicePtr_v[theDeviceId - myInstance_p->firstDeviceId];
-	MapDeviceNets(myInstance_p, myDevice_p, theConnections);
+	MapDeviceNets(myInstance_p, myDevice_p, theConnections, theTerminals, theQueues);
 }
 
 void CCvcDb::MapDeviceSourceDrainNets(deviceId_t theDeviceId, CFullConnection& theConnections) {
@@ -419,12 +426,12 @@ void CCvcDb::MapDeviceSourceDrainNets(deviceId_t theDeviceId, CFullConnection& t
 	SetConnections_(theConnections, theDeviceId);
 	switch (myDevice_p->model_p->type) {
 		case NMOS: case PMOS: case LDDN: case LDDP: {
-			theConnections.originalDrainId = myInstance_p->localToGlobalNetId_v[myDevice_p->signalId_v[0]];
-			theConnections.originalSourceId = myInstance_p->localToGlobalNetId_v[myDevice_p->signalId_v[2]];
+			theConnections.originalDrainId = myInstance_p->LocalToGlobalNetId(myDevice_p->signalId_v[0]);
+			theConnections.originalSourceId = myInstance_p->LocalToGlobalNetId(myDevice_p->signalId_v[2]);
 			break; }
 		case BIPOLAR: case DIODE: case SWITCH_OFF: case FUSE_OFF: case CAPACITOR:	case SWITCH_ON:	case FUSE_ON: case RESISTOR: {
-			theConnections.originalSourceId = myInstance_p->localToGlobalNetId_v[myDevice_p->signalId_v[0]];
-			theConnections.originalDrainId = myInstance_p->localToGlobalNetId_v[myDevice_p->signalId_v[1]];
+			theConnections.originalSourceId = myInstance_p->LocalToGlobalNetId(myDevice_p->signalId_v[0]);
+			theConnections.originalDrainId = myInstance_p->LocalToGlobalNetId(myDevice_p->signalId_v[1]);
 			break; }
 		default: {
 			myDevice_p->model_p->Print();
@@ -457,35 +464,35 @@ void CCvcDb::MapDeviceSourceDrainNets(deviceId_t theDeviceId, CFullConnection& t
 	theConnections.resistance = parameterResistanceMap[theConnections.device_p->parameters];
 }
 
-void CCvcDb::MapDeviceNets(CInstance * theInstance_p, CDevice * theDevice_p, CFullConnection& theConnections) {
+void CCvcDb::MapDeviceNets(CInstance * theInstance_p, CDevice * theDevice_p, CFullConnection& theConnections, int theTerminals, int theQueues) {
 	theConnections.device_p = theDevice_p;
 	theConnections.deviceId = theInstance_p->firstDeviceId + theDevice_p->offset;
 	SetConnections_(theConnections, theConnections.deviceId);
 	switch (theDevice_p->model_p->type) {
 		case NMOS: case PMOS: case LDDN: case LDDP: {
-			theConnections.originalDrainId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[0]];
-			theConnections.originalGateId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[1]];
-			theConnections.originalSourceId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[2]];
+			theConnections.originalDrainId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[0]);
+			theConnections.originalGateId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[1]);
+			theConnections.originalSourceId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[2]);
 			if ( cvcParameters.cvcSOI ) {
 				theConnections.originalBulkId = UNKNOWN_NET;
 			} else {
-				theConnections.originalBulkId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[3]];
+				theConnections.originalBulkId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[3]);
 			}
 			break; }
 		case DIODE: case SWITCH_OFF: case FUSE_OFF: case CAPACITOR:	case SWITCH_ON:	case FUSE_ON: case RESISTOR: {
-			theConnections.originalSourceId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[0]];
+			theConnections.originalSourceId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[0]);
 			theConnections.originalGateId = UNKNOWN_NET;
-			theConnections.originalDrainId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[1]];
+			theConnections.originalDrainId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[1]);
 			if ( theDevice_p->signalId_v.size() == 3 ) {
-				theConnections.originalBulkId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[2]];;
+				theConnections.originalBulkId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[2]);;
 			} else {
 				theConnections.originalBulkId = UNKNOWN_NET;
 			}
 			break; }
 		case BIPOLAR: {
-			theConnections.originalSourceId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[0]];
-			theConnections.originalGateId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[1]];
-			theConnections.originalDrainId = theInstance_p->localToGlobalNetId_v[theDevice_p->signalId_v[2]];
+			theConnections.originalSourceId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[0]);
+			theConnections.originalGateId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[1]);
+			theConnections.originalDrainId = theInstance_p->LocalToGlobalNetId(theDevice_p->signalId_v[2]);
 			theConnections.originalBulkId = UNKNOWN_NET;
 			break; }
 		default: {
@@ -493,69 +500,57 @@ void CCvcDb::MapDeviceNets(CInstance * theInstance_p, CDevice * theDevice_p, CFu
 			throw EUnknownModel();
 		}
 	}
-	theConnections.masterMaxSourceNet(maxNet_v, theConnections.sourceId);
-	theConnections.masterMaxGateNet(maxNet_v, theConnections.gateId);
-	theConnections.masterMaxDrainNet(maxNet_v, theConnections.drainId);
-	theConnections.masterMaxBulkNet(maxNet_v, theConnections.bulkId);
-	theConnections.maxSourceVoltage = netVoltagePtr_v.MaxVoltage(theConnections.masterMaxSourceNet.finalNetId);
-	theConnections.maxGateVoltage = netVoltagePtr_v.MaxVoltage(theConnections.masterMaxGateNet.finalNetId);
-	theConnections.maxDrainVoltage = netVoltagePtr_v.MaxVoltage(theConnections.masterMaxDrainNet.finalNetId);
-	theConnections.maxBulkVoltage = netVoltagePtr_v.MaxVoltage(theConnections.masterMaxBulkNet.finalNetId);
-	theConnections.maxSourcePower_p = netVoltagePtr_v[theConnections.masterMaxSourceNet.finalNetId].full;
-	theConnections.maxDrainPower_p = netVoltagePtr_v[theConnections.masterMaxDrainNet.finalNetId].full;
-	if ( theConnections.masterMaxGateNet.finalNetId == UNKNOWN_NET ) {
-		theConnections.maxGatePower_p = NULL;
-	} else {
-		theConnections.maxGatePower_p = netVoltagePtr_v[theConnections.masterMaxGateNet.finalNetId].full;
-	}
-	if ( theConnections.masterMaxBulkNet.finalNetId == UNKNOWN_NET ) {
-		theConnections.maxBulkPower_p = NULL;
-	} else {
-		theConnections.maxBulkPower_p = netVoltagePtr_v[theConnections.masterMaxBulkNet.finalNetId].full;
-	}
+	theConnections.ResetResolvedConnections();
+	ResolveConnections(theConnections, theTerminals, theQueues);
+	theConnections.resistance = parameterResistanceMap[theConnections.device_p->parameters];
+}
 
-	theConnections.masterMinSourceNet(minNet_v, theConnections.sourceId);
-	theConnections.masterMinGateNet(minNet_v, theConnections.gateId);
-	theConnections.masterMinDrainNet(minNet_v, theConnections.drainId);
-	theConnections.masterMinBulkNet(minNet_v, theConnections.bulkId);
-	theConnections.minSourceVoltage = netVoltagePtr_v.MinVoltage(theConnections.masterMinSourceNet.finalNetId);
-	theConnections.minGateVoltage = netVoltagePtr_v.MinVoltage(theConnections.masterMinGateNet.finalNetId);
-	theConnections.minDrainVoltage = netVoltagePtr_v.MinVoltage(theConnections.masterMinDrainNet.finalNetId);
-	theConnections.minBulkVoltage = netVoltagePtr_v.MinVoltage(theConnections.masterMinBulkNet.finalNetId);
-	theConnections.minSourcePower_p = netVoltagePtr_v[theConnections.masterMinSourceNet.finalNetId].full;
-	theConnections.minDrainPower_p = netVoltagePtr_v[theConnections.masterMinDrainNet.finalNetId].full;
-	if ( theConnections.masterMinGateNet.finalNetId == UNKNOWN_NET ) {
-		theConnections.minGatePower_p = NULL;
-	} else {
-		theConnections.minGatePower_p = netVoltagePtr_v[theConnections.masterMinGateNet.finalNetId].full;
+void CCvcDb::ResolveTerminal(CVirtualNetVector& theVirtualNet_v, eventQueue_t theQueue, netId_t theNetId, CVirtualNet& theMasterNet, voltage_t& theVoltage, CPower * & thePower_p) {
+	// Trace one terminal to its final net and cache the voltage and power for one queue.
+	theMasterNet(theVirtualNet_v, theNetId);
+	if ( theMasterNet.finalNetId == UNKNOWN_NET ) {
+		thePower_p = NULL;
+		theVoltage = UNKNOWN_VOLTAGE;
+		return;
 	}
-	if ( theConnections.masterMinBulkNet.finalNetId == UNKNOWN_NET ) {
-		theConnections.minBulkPower_p = NULL;
+	thePower_p = netVoltagePtr_v[theMasterNet.finalNetId].full;
+	if ( thePower_p == NULL ) {
+		theVoltage = UNKNOWN_VOLTAGE;
+	} else if ( theQueue == MIN_QUEUE ) {
+		theVoltage = thePower_p->minVoltage;
+	} else if ( theQueue == MAX_QUEUE ) {
+		theVoltage = thePower_p->maxVoltage;
 	} else {
-		theConnections.minBulkPower_p = netVoltagePtr_v[theConnections.masterMinBulkNet.finalNetId].full;
+		theVoltage = thePower_p->simVoltage;
 	}
+}
 
-	theConnections.masterSimSourceNet(simNet_v, theConnections.sourceId);
-	theConnections.masterSimGateNet(simNet_v, theConnections.gateId);
-	theConnections.masterSimDrainNet(simNet_v, theConnections.drainId);
-	theConnections.masterSimBulkNet(simNet_v, theConnections.bulkId);
-	theConnections.simSourceVoltage = netVoltagePtr_v.SimVoltage(theConnections.masterSimSourceNet.finalNetId);
-	theConnections.simGateVoltage = netVoltagePtr_v.SimVoltage(theConnections.masterSimGateNet.finalNetId);
-	theConnections.simDrainVoltage = netVoltagePtr_v.SimVoltage(theConnections.masterSimDrainNet.finalNetId);
-	theConnections.simBulkVoltage = netVoltagePtr_v.SimVoltage(theConnections.masterSimBulkNet.finalNetId);
-	theConnections.simSourcePower_p = netVoltagePtr_v[theConnections.masterSimSourceNet.finalNetId].full;
-	theConnections.simDrainPower_p = netVoltagePtr_v[theConnections.masterSimDrainNet.finalNetId].full;
-	if ( theConnections.masterSimGateNet.finalNetId == UNKNOWN_NET ) {
-		theConnections.simGatePower_p = NULL;
-	} else {
-		theConnections.simGatePower_p = netVoltagePtr_v[theConnections.masterSimGateNet.finalNetId].full;
-	}
-	if ( theConnections.masterSimBulkNet.finalNetId == UNKNOWN_NET ) {
-		theConnections.simBulkPower_p = NULL;
-	} else {
-		theConnections.simBulkPower_p = netVoltagePtr_v[theConnections.masterSimBulkNet.finalNetId].full;
+void CCvcDb::ResolveConnections(CFullConnection& theConnections, int theTerminals, int theQueues) {
+	// Resolve only the requested terminals for the requested queues. Previously resolved terminals are skipped.
+	if ( theQueues & MAX_CONNECTIONS ) {
+		int myTerminals = theTerminals & ~theConnections.resolvedMaxTerminals;
+		if ( myTerminals & SOURCE ) ResolveTerminal(maxNet_v, MAX_QUEUE, theConnections.sourceId, theConnections.masterMaxSourceNet, theConnections.maxSourceVoltage, theConnections.maxSourcePower_p);
+		if ( myTerminals & GATE ) ResolveTerminal(maxNet_v, MAX_QUEUE, theConnections.gateId, theConnections.masterMaxGateNet, theConnections.maxGateVoltage, theConnections.maxGatePower_p);
+		if ( myTerminals & DRAIN ) ResolveTerminal(maxNet_v, MAX_QUEUE, theConnections.drainId, theConnections.masterMaxDrainNet, theConnections.maxDrainVoltage, theConnections.maxDrainPower_p);
+		if ( myTerminals & BULK ) ResolveTerminal(maxNet_v, MAX_QUEUE, theConnections.bulkId, theConnections.masterMaxBulkNet, theConnections.maxBulkVoltage, theConnections.maxBulkPower_p);
+		theConnections.resolvedMaxTerminals |= myTerminals;
+	}
+	if ( theQueues & MIN_CONNECTIONS ) {
+		int myTerminals = theTerminals & ~theConnections.resolvedMinTerminals;
+		if ( myTerminals & SOURCE ) ResolveTerminal(minNet_v, MIN_QUEUE, theConnections.sourceId, theConnections.masterMinSourceNet, theConnections.minSourceVoltage, theConnections.minSourcePower_p);
+		if ( myTerminals & GATE ) ResolveTerminal(minNet_v, MIN_QUEUE, theConnections.gateId, theConnections.masterMinGateNet, theConnections.minGateVoltage, theConnections.minGatePower_p);
+		if ( myTerminals & DRAIN ) ResolveTerminal(minNet_v, MIN_QUEUE, theConnections.drainId, theConnections.masterMinDrainNet, theConnections.minDrainVoltage, theConnections.minDrainPower_p);
+		if ( myTerminals & BULK ) ResolveTerminal(minNet_v, MIN_QUEUE, theConnections.bulkId, theConnections.masterMinBulkNet, theConnections.minBulkVoltage, theConnections.minBulkPower_p);
+		theConnections.resolvedMinTerminals |= myTerminals;
+	}
+	if ( theQueues & SIM_CONNECTIONS ) {
+		int myTerminals = theTerminals & ~theConnections.resolvedSimTerminals;
+		if ( myTerminals & SOURCE ) ResolveTerminal(simNet_v, SIM_QUEUE, theConnections.sourceId, theConnections.masterSimSourceNet, theConnections.simSourceVoltage, theConnections.simSourcePower_p);
+		if ( myTerminals & GATE ) ResolveTerminal(simNet_v, SIM_QUEUE, theConnections.gateId, theConnections.masterSimGateNet, theConnections.simGateVoltage, theConnections.simGatePower_p);
+		if ( myTerminals & DRAIN ) ResolveTerminal(simNet_v, SIM_QUEUE, theConnections.drainId, theConnections.masterSimDrainNet, theConnections.simDrainVoltage, theConnections.simDrainPower_p);
+		if ( myTerminals & BULK ) ResolveTerminal(simNet_v, SIM_QUEUE, theConnections.bulkId, theConnections.masterSimBulkNet, theConnections.simBulkVoltage, theConnections.simBulkPower_p);
+		theConnections.resolvedSimTerminals |= myTerminals;
 	}
-	theConnections.resistance = parameterResistanceMap[theConnections.device_p->parameters];
 }
 
 void CCvcDb::IgnoreDevice(deviceId_t theDeviceId) {
@@ -745,10 +740,11 @@ size_t CCvcDb::IncrementDeviceError(deviceId_t theDeviceId, int theErrorIndex) {
 	int myErrorSubIndex = 0;
 	if ( theErrorIndex >= OVERVOLTAGE_VBG && theErrorIndex <= MODEL_CHECK ) {
 		myErrorSubIndex = theErrorIndex - OVERVOLTAGE_VBG;
+	} else if ( theErrorIndex == NMOS_SOURCE_BULK || theErrorIndex == PMOS_SOURCE_BULK ) {
+		myErrorSubIndex = SOURCE_BULK_ERROR_SUBINDEX;
 	}
-	int myMFactor = CalculateMFactor(deviceParent_v[theDeviceId]);
+	int myMFactor = CalculateMFactor(deviceParent_v[theDeviceId]) * myParent_p->devicePtr_v[theDeviceId - myInstance_p->firstDeviceId]->fingerCount;
 	size_t myReturnCount = myParent_p->devicePrintCount_v[theDeviceId - myInstance_p->firstDeviceId][myErrorSubIndex] + 1;
-	string myKey = "";
 	deviceId_t myLimit = UNKNOWN_DEVICE;
 	if ( ! IsEmpty(cvcParameters.cvcCellErrorLimitFile) ) {
 		instanceId_t myAncestor = deviceParent_v[theDeviceId];
@@ -758,13 +754,16 @@ size_t CCvcDb::IncrementDeviceError(deviceId_t theDeviceId, int theErrorIndex) {
 		if (myAncestor > 0) {
 			myLimit = instancePtr_v[myAncestor]->master_p->errorLimit;
 			if ( myLimit > 0 ) {
-				myKey = string(instancePtr_v[myAncestor]->master_p->name) + " " + string(myParent_p->name) + " "
-						+ to_string<deviceId_t>(theDeviceId - myInstance_p->firstDeviceId) + " " + to_string<int>(myErrorSubIndex);
-				cellErrorCountMap[myKey]++;
-				if ( cellErrorCountMap[myKey] > myLimit ) {
+				// the first instance of a circuit is never parallel, so its device ids identify (parent circuit, device)
+				CInstance * myFirstInstance_p = instancePtr_v[myParent_p->instanceId_v[0]];
+				assert( ! myFirstInstance_p->IsParallelInstance() );
+				deviceId_t & myCount = cellErrorCountMap[CellErrorKey_(instancePtr_v[myAncestor]->master_p->errorLimitId,
+					myFirstInstance_p->firstDeviceId + theDeviceId - myInstance_p->firstDeviceId, myErrorSubIndex)];
+				myCount++;
+				if ( myCount > myLimit ) {
 					myReturnCount = UNKNOWN_DEVICE;
 				} else {
-					myReturnCount = cellErrorCountMap[myKey];  // if limit is set, always print up to error limit
+					myReturnCount = myCount;  // if limit is set, always print up to error limit
 				}
 			} else {  // no map entries needed if limit is 0
 				myReturnCount = UNKNOWN_DEVICE;
@@ -870,7 +869,7 @@ eventKey_t CCvcDb::SimKey(eventKey_t theCurrentKey, resistance_t theIncrement) {
 }
 
 bool CCvcDb::IsDerivedFromFloating(CVirtualNetVector& theVirtualNet_v, netId_t theNetId) {
-	static CVirtualNet	myVirtualNet;
+	CVirtualNet	myVirtualNet;
 	assert(theNetId == GetEquivalentNet(theNetId));
 	myVirtualNet(theVirtualNet_v, theNetId);
 	return( netVoltagePtr_v[myVirtualNet.finalNetId].full && netVoltagePtr_v[myVirtualNet.finalNetId].full->type[HIZ_BIT] );
@@ -1056,34 +1055,18 @@ void CCvcDb::Cleanup() {
 	if ( errorFile.is_open() ) errorFile.close();
 	if ( debugFile.is_open() ) debugFile.close();
 	RemoveLock();
-#ifdef CVC_MEMORY_DEBUG
-	try {
-		cvcParameters.cvcPowerPtrList.Clear(leakVoltagePtr_v, netVoltagePtr_v, netCount);  // defined power deleted here
-		if ( gDebug_cvc ) cout << "Cleared power pointer list" << endl;
-		int myDeleteCount = 0;
-		for ( netId_t net_it = 0; net_it < netCount; net_it++ ) {
-			CPower * myPower_p = netVoltagePtr_v[net_it].full;
-			if ( leakVoltageSet ) {
-				CPower * myLeakPower_p = leakVoltagePtr_v[net_it].full;
-				if ( leakVoltagePtr_v.size() > net_it && myLeakPower_p && myPower_p != myLeakPower_p ) {  // unique leak power deleted here
-					if ( myLeakPower_p->extraData ) {
-						if ( gDebug_cvc ) cout << "DEBUG: extra data at net " << net_it << endl;
-					}
-					delete myLeakPower_p;
-					myDeleteCount++;
-				}
-			}
-			if ( netVoltagePtr_v.size() > net_it && myPower_p ) {  // calculated power deleted here
-				if ( myPower_p->extraData ) {
-					if ( gDebug_cvc ) cout << "DEBUG: extra data at net " << net_it << endl;
-				}
-				delete myPower_p;
-				myDeleteCount++;
-			}
-		}
-		if ( gDebug_cvc ) cout << "DEBUG: Deleted " << myDeleteCount << " power objects" << endl;
-		cvcParameters.cvcExpectedLevelPtrList.Clear();
-		cvcParameters.cvcPowerMacroPtrMap.Clear();
+	// all power objects are in CPower::powerPool. drop references and free in bulk.
+	if ( gDebug_cvc ) cout << "DEBUG: Releasing " << CPower::powerPool.liveCount << " power objects" << endl;
+	cvcParameters.cvcPowerPtrList.clear();
+	cvcParameters.cvcExpectedLevelPtrList.clear();
+	cvcParameters.cvcPowerMacroPtrMap.clear();
+	netVoltagePtr_v.ResetPowerPointerVector(0);
+	leakVoltagePtr_v.ResetPowerPointerVector(0);
+	initialVoltagePtr_v.ResetPowerPointerVector(0);
+	leakVoltageSet = false;
+	CPower::powerPool.Release();
+#ifdef CVC_MEMORY_DEBUG
+	try {
 		CPower::powerDefinitionText.Clear();
 		cvcParameters.cvcModelListMap.Clear();
 	}
@@ -1704,7 +1687,7 @@ bool CCvcDb::IsInstanceNet(netId_t theNetId, instanceId_t theInstance) {
 	CInstance * myInstance_p = instancePtr_v[theInstance];
 	CCircuit * myCircuit_p = myInstance_p->master_p;
 	for ( netId_t port_it = 0; port_it < myCircuit_p->portCount; port_it++ ) {
-		if ( theNetId == GetEquivalentNet(myInstance_p->localToGlobalNetId_v[port_it]) ) return true;
+		if ( theNetId == GetEquivalentNet(myInstance_p->LocalToGlobalNetId(port_it)) ) return true;
 	}
 	return false;
 }
@@ -1717,7 +1700,7 @@ instanceId_t CCvcDb::FindNetInstance(netId_t theNetId, instanceId_t theInstance)
 	CInstance * myInstance_p = instancePtr_v[theInstance];
 	CCircuit * myCircuit_p = myInstance_p->master_p;
 	for ( netId_t port_it = 0; port_it < myCircuit_p->portCount; port_it++ ) {
-		if ( theNetId == GetEquivalentNet(myInstance_p->localToGlobalNetId_v[port_it]) ) return theInstance;
+		if ( theNetId == GetEquivalentNet(myInstance_p->LocalToGlobalNetId(port_it)) ) return theInstance;
 	}
 	return UNKNOWN_INSTANCE;
 }
@@ -1734,11 +1717,16 @@ text_t CCvcDb::GetLocalNetName(instanceId_t theInstance, netId_t theNet) {
 	// requires 2 reverse searches
 	CInstance * myInstance_p = instancePtr_v[theInstance];
 	CCircuit * myMaster_p = myInstance_p->master_p;
+	if ( myInstance_p->IsParallelInstance() ) return(NULL);
 	netId_t net_it = 0;
-	while ( net_it < myInstance_p->localToGlobalNetId_v.size() && myInstance_p->localToGlobalNetId_v[net_it] != theNet ) {
+	while ( net_it < myInstance_p->portNetId_v.size() && myInstance_p->portNetId_v[net_it] != theNet ) {
 		net_it++;
 	}
-	if ( net_it >= myInstance_p->localToGlobalNetId_v.size() ) return(NULL);
+	if ( net_it >= myInstance_p->portNetId_v.size() ) {  // internal nets are consecutive
+		if ( myInstance_p->portNetId_v.size() > myMaster_p->portCount ) return(NULL);  // top instance maps all nets
+		if ( theNet < myInstance_p->firstNetId || theNet - myInstance_p->firstNetId >= myMaster_p->LocalNetCount() ) return(NULL);
+		net_it = theNet - myInstance_p->firstNetId + myMaster_p->portCount;
+	}
 	for( auto signalMap_pit = myMaster_p->localSignalIdMap.begin(); signalMap_pit != myMaster_p->localSignalIdMap.end(); signalMap_pit++ ) {
 		if ( signalMap_pit->second == net_it ) return signalMap_pit->first;
 	}
@@ -31,13 +31,17 @@ string CCvcParameters::CvcFileName() {
 }
 
 bool CCvcParameters::IsSameDatabase() {
-	return(cvcLastTopBlock == cvcTopBlock && cvcLastNetlistFilename == cvcNetlistFilename && cvcLastSOI == cvcSOI);
+	return(cvcLastTopBlock == cvcTopBlock && cvcLastNetlistFilename == cvcNetlistFilename && cvcLastSOI == cvcSOI
+		&& cvcLastMergeIdenticalCircuits == cvcMergeIdenticalCircuits
+		&& ( ! cvcMergeIdenticalCircuits || cvcLastCellFilterKey == cvcModelListMap.CellFilterKey() ));
 }
 
 void CCvcParameters::SaveDatabaseParameters() {
 		cvcLastTopBlock = cvcTopBlock;
 		cvcLastNetlistFilename = cvcNetlistFilename;
 		cvcLastSOI = cvcSOI;
+		cvcLastMergeIdenticalCircuits = cvcMergeIdenticalCircuits;
+		cvcLastCellFilterKey = ( cvcMergeIdenticalCircuits ) ? cvcModelListMap.CellFilterKey() : "";
 }
 
 void CCvcParameters::ResetEnvironment() {
@@ -87,6 +91,12 @@ void CCvcParameters::ResetEnvironment() {
 	//! When false, ignore errors from analog gates. Default is to use analog values.
 	cvcBackupResults = defaultBackupResults;
 	//! When true, backup log and error file. Default is to not create backups.
+	cvcMergeParallelFingers = defaultMergeParallelFingers;
+	//! When true, mosfets with identical model, parameters and connections are checked once. Default is to check every finger.
+	cvcCompactParentIndex = defaultCompactParentIndex;
+	//! When true, store net and device parents as instance ranges. Default is one parent per net and device. Applied when the netlist is read.
+	cvcMergeIdenticalCircuits = defaultMergeIdenticalCircuits;
+	//! When true, circuits that differ only in name are replaced by the first one. Default is to keep every circuit.
 	cvcMosDiodeErrorThreshold = defaultErrorThreshold;
 	cvcShortErrorThreshold = defaultErrorThreshold;
 	cvcBiasErrorThreshold = defaultErrorThreshold;
@@ -98,7 +108,7 @@ void CCvcParameters::ResetEnvironment() {
 	cvcOvervoltageErrorThreshold = defaultErrorThreshold;
 	//! Ignore errors with voltage difference less than the threshold. Default is 0, flag errors regardless of voltage difference.
 	cvcParallelCircuitPortLimit = defaultParallelCircuitPortLimit;
-	//! Port count limit for parallel cell processing
+	//! Port count limit for parallel cell processing. Instances of cells with more ports are always expanded.
 	cvcCellErrorLimitFile = defaultCellErrorLimitFile;
 	//! Name of file containing list of cells with error limits
 	cvcCellChecksumFile = defaultCellChecksumFile;
@@ -134,6 +144,9 @@ void CCvcParameters::PrintEnvironment(ostream & theOutputFile) {
 	theOutputFile << "CVC_LOGIC_DIODES = '" << (( cvcLogicDiodes ) ? "true" : "false") << "'" << endl;
 	theOutputFile << "CVC_ANALOG_GATES = '" << (( cvcAnalogGates ) ? "true" : "false") << "'" << endl;
 	theOutputFile << "CVC_BACKUP_RESULTS = '" << (( cvcBackupResults ) ? "true" : "false") << "'" << endl;
+	theOutputFile << "CVC_MERGE_PARALLEL_FINGERS = '" << (( cvcMergeParallelFingers ) ? "true" : "false") << "'" << endl;
+	theOutputFile << "CVC_COMPACT_PARENT_INDEX = '" << (( cvcCompactParentIndex ) ? "true" : "false") << "'" << endl;
+	theOutputFile << "CVC_MERGE_IDENTICAL_CIRCUITS = '" << (( cvcMergeIdenticalCircuits ) ? "true" : "false") << "'" << endl;
 	theOutputFile << "CVC_MOS_DIODE_ERROR_THRESHOLD = '" << Voltage_to_float(cvcMosDiodeErrorThreshold) << "'" << endl;
 	theOutputFile << "CVC_SHORT_ERROR_THRESHOLD = '" << Voltage_to_float(cvcShortErrorThreshold) << "'" << endl;
 	theOutputFile << "CVC_BIAS_ERROR_THRESHOLD = '" << Voltage_to_float(cvcBiasErrorThreshold) << "'" << endl;
@@ -181,6 +194,9 @@ void CCvcParameters::PrintDefaultEnvironment() {
 	myDefaultCvcrc << "CVC_LOGIC_DIODES = '" << (( cvcLogicDiodes ) ? "true" : "false") << "'" << endl;
 	myDefaultCvcrc << "CVC_ANALOG_GATES = '" << (( cvcAnalogGates ) ? "true" : "false") << "'" << endl;
 	myDefaultCvcrc << "CVC_BACKUP_RESULTS = '" << (( cvcBackupResults ) ? "true" : "false") << "'" << endl;
+	myDefaultCvcrc << "CVC_MERGE_PARALLEL_FINGERS = '" << (( cvcMergeParallelFingers ) ? "true" : "false") << "'" << endl;
+	myDefaultCvcrc << "CVC_COMPACT_PARENT_INDEX = '" << (( cvcCompactParentIndex ) ? "true" : "false") << "'" << endl;
+	myDefaultCvcrc << "CVC_MERGE_IDENTICAL_CIRCUITS = '" << (( cvcMergeIdenticalCircuits ) ? "true" : "false") << "'" << endl;
 	myDefaultCvcrc << "CVC_MOS_DIODE_ERROR_THRESHOLD = '" << Voltage_to_float(cvcMosDiodeErrorThreshold) << "'" << endl;
 	myDefaultCvcrc << "CVC_SHORT_ERROR_THRESHOLD = '" << Voltage_to_float(cvcShortErrorThreshold) << "'" << endl;
 	myDefaultCvcrc << "CVC_BIAS_ERROR_THRESHOLD = '" << Voltage_to_float(cvcBiasErrorThreshold) << "'" << endl;
@@ -276,6 +292,12 @@ void CCvcParameters::LoadEnvironment(const string theEnvironmentFilename, const
 			cvcAnalogGates = strcasecmp(myBuffer, "true") == 0;
 		} else if ( myVariable == "CVC_BACKUP_RESULTS" ) {
 			cvcBackupResults = strcasecmp(myBuffer, "true") == 0;
+		} else if ( myVariable == "CVC_MERGE_PARALLEL_FINGERS" ) {
+			cvcMergeParallelFingers = strcasecmp(myBuffer, "true") == 0;
+		} else if ( myVariable == "CVC_COMPACT_PARENT_INDEX" ) {
+			cvcCompactParentIndex = strcasecmp(myBuffer, "true") == 0;
+		} else if ( myVariable == "CVC_MERGE_IDENTICAL_CIRCUITS" ) {
+			cvcMergeIdenticalCircuits = strcasecmp(myBuffer, "true") == 0;
 		} else if ( myVariable == "CVC_MOS_DIODE_ERROR_THRESHOLD" ) {
 			cvcMosDiodeErrorThreshold = String_to_Voltage(string(myBuffer));
 		} else if ( myVariable == "CVC_SHORT_ERROR_THRESHOLD" ) {
@@ -295,12 +317,7 @@ void CCvcParameters::LoadEnvironment(const string theEnvironmentFilename, const
 		} else if ( myVariable == "CVC_OVERVOLTAGE_ERROR_THRESHOLD" ) {
 			cvcOvervoltageErrorThreshold = String_to_Voltage(string(myBuffer));
 		} else if ( myVariable == "CVC_PARALLEL_CIRCUIT_PORT_LIMIT" ) {
-			cvcParallelCircuitPortLimit = from_string<int>(myBuffer);
-			if ( cvcParallelCircuitPortLimit > MAX_PARALLEL_CIRCUIT_PORT_LIMIT ) {
-				reportFile << "Warning: Parallel circuit port limit exceeds maximum " << cvcParallelCircuitPortLimit << " > " << MAX_PARALLEL_CIRCUIT_PORT_LIMIT << endl;
-				reportFile << "Parallel circuit port limit set to " << MAX_PARALLEL_CIRCUIT_PORT_LIMIT << endl;
-				cvcParallelCircuitPortLimit = MAX_PARALLEL_CIRCUIT_PORT_LIMIT;
-			}
+			cvcParallelCircuitPortLimit = from_string<size_t>(myBuffer);
 		} else if ( myVariable == "CVC_CELL_ERROR_LIMIT_FILE" ) {
 			cvcCellErrorLimitFile = myBuffer;
 		} else if ( myVariable == "CVC_CELL_CHECKSUM_FILE" ) {
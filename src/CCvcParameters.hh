@@ -51,6 +51,9 @@ public:
 	const bool defaultLogicDiodes = false;
 	const bool defaultAnalogGates = true;
 	const bool defaultBackupResults = false;
+	const bool defaultMergeParallelFingers = false;
+	const bool defaultCompactParentIndex = false;
+	const bool defaultMergeIdenticalCircuits = false;
 	const voltage_t defaultErrorThreshold = 0;
 	const size_t defaultParallelCircuitPortLimit = 0;
 	const string defaultCellErrorLimitFile = "";
@@ -94,6 +97,9 @@ public:
 	bool	cvcLogicDiodes = defaultLogicDiodes;
 	bool	cvcAnalogGates = defaultAnalogGates;
 	bool	cvcBackupResults = defaultBackupResults;
+	bool	cvcMergeParallelFingers = defaultMergeParallelFingers;
+	bool	cvcCompactParentIndex = defaultCompactParentIndex;
+	bool	cvcMergeIdenticalCircuits = defaultMergeIdenticalCircuits;
 	voltage_t	cvcMosDiodeErrorThreshold = defaultErrorThreshold;
 	voltage_t	cvcShortErrorThreshold = defaultErrorThreshold;
 	voltage_t	cvcBiasErrorThreshold = defaultErrorThreshold;
@@ -113,6 +119,8 @@ public:
 	string	cvcLastTopBlock;
 	string	cvcLastNetlistFilename;
 	bool	cvcLastSOI;
+	bool	cvcLastMergeIdenticalCircuits;
+	string	cvcLastCellFilterKey;  // cell filtered models used when merging identical circuits
 
 	teestream& reportFile;
 
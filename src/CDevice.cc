@@ -74,10 +74,24 @@ void CDevicePtrList::Print (CTextVector& theSignalName_v, const string theIndent
 	cout << theIndentation << myHeading << " end" << endl;
 }
 
-CDevicePtrVector::~CDevicePtrVector() {
-	for ( auto device_ppit = begin(); device_ppit != end(); device_ppit++ ) {
-		delete (*device_ppit);
+CDevice * CDeviceArena::New() {
+	if ( used == blockSize ) {
+		block_v.push_back(new CDevice[blockSize]);
+		used = 0;
+	}
+	return ( &block_v.back()[used++] );
+}
+
+void CDeviceArena::Clear() {
+	for ( auto block_pit = block_v.begin(); block_pit != block_v.end(); block_pit++ ) {
+		delete [] (*block_pit);
 	}
+	block_v.clear();
+	block_v.shrink_to_fit();
+	used = blockSize;
+}
+
+CDevicePtrVector::~CDevicePtrVector() {
 	resize(0);
 }
 
@@ -107,49 +121,46 @@ void CDevicePtrVector::Print(CTextVector& theSignalName_v, CCircuit * theParent_
 	}
 }
 
-#define A_PRIME 0xcc9e2d51
-
-instanceId_t CDevice::MakePortHash(CNetIdVector & theLocalToGlobalNetId_v) {
-	instanceId_t myHash = 0;
-	for ( netId_t port_it = 0; port_it < master_p->portCount; port_it++ ) {
-		myHash = myHash << 16 ^ theLocalToGlobalNetId_v[signalId_v[port_it]] ^ myHash;
-		myHash *= A_PRIME;
-	}
-	return ( myHash % master_p->instanceCount );
-}
+uint64_t CDevice::MakePortHash(CInstance * theParent_p) {
+	/// 64 bit signature of the global port nets. Equal signatures are verified by port compare.
+	uint64_t myHash = master_p->portCount;
+	for ( netId_t port_it = 0; port_it < master_p->portCount; port_it++ ) {
+		myHash = ( myHash ^ theParent_p->LocalToGlobalNetId(signalId_v[port_it]) ) * 0x100000001b3ULL;
+	}
+	myHash ^= myHash >> 33;  // final mix so that the low (table index) bits depend on every port
+	myHash *= 0xff51afd7ed558ccdULL;
+	myHash ^= myHash >> 33;
+	return ( myHash );
+}
 
 extern int gHashCollisionCount;
 extern int gMaxHashLength;
 
-instanceId_t CDevice::FindParallelInstance(CCvcDb * theCvcDb_p, instanceId_t theInstanceId, CNetIdVector & theLocalToGlobalNetId_v) {
-	// Executed once and only once for each instance
-	instanceId_t myKey = MakePortHash(theLocalToGlobalNetId_v);
-	assert(myKey != UNKNOWN_DEVICE && myKey < master_p->instanceCount );
-	if ( master_p->instanceHashId_v[myKey] == UNKNOWN_DEVICE ) {
-		master_p->instanceHashId_v[myKey] = theInstanceId;
-	} else {
-		instanceId_t myCheckInstanceId = master_p->instanceHashId_v[myKey];
-		CInstance * myInstance_p;
-		int myHashLength = 0;
-		do {
-			myInstance_p = theCvcDb_p->instancePtr_v[myCheckInstanceId];
-			if ( master_p != myInstance_p->master_p ) {
-				cout << "DEBUG: master mismatch at instance " << theInstanceId << " and " << myCheckInstanceId << endl;
-				cout << "  " << master_p->name << " != " << myInstance_p->master_p->name << endl;
-			}
-			for ( netId_t port_it = 0; port_it <= master_p->portCount; port_it++ ) {
-				if ( port_it == master_p->portCount ) {  // all ports match
-					return (myCheckInstanceId);
-				} else {
-					if (theLocalToGlobalNetId_v[signalId_v[port_it]] != myInstance_p->localToGlobalNetId_v[port_it]) break;
-				}
+instanceId_t CDevice::FindParallelInstance(CCvcDb * theCvcDb_p, instanceId_t theInstanceId, CInstance * theParent_p) {
+	// Executed once and only once for each instance. Returns the first instance with identical port nets or theInstanceId.
+	// Linear probing in the open addressed master table. The table is at least twice the instance count, so probing always ends.
+	assert(master_p->instanceHashId_v.size() > 0);
+	uint64_t myHash = MakePortHash(theParent_p);
+	size_t myMask = master_p->instanceHashId_v.size() - 1;
+	int myHashLength = 0;
+	for ( size_t slot_it = myHash & myMask; ; slot_it = ( slot_it + 1 ) & myMask ) {
+		instanceId_t myCheckInstanceId = master_p->instanceHashId_v[slot_it];
+		if ( myCheckInstanceId == UNKNOWN_INSTANCE ) {  // new port combination
+			master_p->instanceHashId_v[slot_it] = theInstanceId;
+			master_p->instanceHash_v[slot_it] = myHash;
+			if ( gMaxHashLength < myHashLength ) gMaxHashLength = myHashLength;
+			return (theInstanceId);
+		}
+		if ( master_p->instanceHash_v[slot_it] == myHash ) {
+			CInstance * myInstance_p = theCvcDb_p->instancePtr_v[myCheckInstanceId];
+			netId_t port_it = 0;
+			while ( port_it < master_p->portCount
+					&& theParent_p->LocalToGlobalNetId(signalId_v[port_it]) == myInstance_p->portNetId_v[port_it] ) {
+				port_it++;
 			}
-			myHashLength++;
-			gHashCollisionCount++;
-			myCheckInstanceId = myInstance_p->nextHashedInstanceId;
-		} while ( myCheckInstanceId != UNKNOWN_DEVICE );
-		if ( gMaxHashLength < myHashLength ) gMaxHashLength = myHashLength;
-		myInstance_p->nextHashedInstanceId = theInstanceId;
+			if ( port_it == master_p->portCount ) return (myCheckInstanceId);  // all ports match
+		}
+		myHashLength++;
+		gHashCollisionCount++;
 	}
-	return (theInstanceId);
 }
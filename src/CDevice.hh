@@ -30,12 +30,13 @@ class CCvcDb;
 #include "CModel.hh"
 
 class CCircuit;
+class CInstance;
 
 class CDevice {
 public:
 	text_t name;
-	CTextList * signalList_p;
-	CNetIdVector signalId_v;
+	CTextList * signalList_p = NULL;  // parsed signal names. released after LoadDevices
+	CNetIdSpan signalId_v;  // local net ids in the parent circuit's signalIdPool_v
 	CCircuit * parent_p;
 
 	union {
@@ -48,9 +49,11 @@ public:
 	};
 	text_t parameters;
 	deviceId_t offset;  // offset in circuit (devices and subcircuit instances counted separately)
-	bool	sourceDrainSet = false;
-	bool	sourceDrainSwapOk = true;
+	deviceId_t	sourceDrainSet:1;
+	deviceId_t	sourceDrainSwapOk:1;
+	deviceId_t	fingerCount:30;  // parallel fingers represented by this device. 0 if merged into another device. see CCvcDb::MergeParallelFingers
 
+	CDevice() : sourceDrainSet(false), sourceDrainSwapOk(true), fingerCount(1) {}
 	~CDevice();
 	inline void AppendSignal (text_t theNewSignal) {
 		// skip null signals (missing bias)
@@ -69,8 +72,8 @@ public:
 	void Print(CTextVector& theSignalName_v, deviceId_t theDeviceId,
 			const string theIndentation = "");
  
-	instanceId_t MakePortHash(CNetIdVector & theLocalToGlobalNetId_v);
-	instanceId_t FindParallelInstance(CCvcDb * theCCvcDb_p, instanceId_t theInstanceId, CNetIdVector & theLocalToGlobalNetId_v);
+	uint64_t MakePortHash(CInstance * theParent_p);
+	instanceId_t FindParallelInstance(CCvcDb * theCCvcDb_p, instanceId_t theInstanceId, CInstance * theParent_p);
 };
 
 class CDevicePtrList : public list<CDevice *> {
@@ -83,7 +86,19 @@ public:
 			const string theHeading = "DeviceList>");
 };
 
-class CDevicePtrVector : public vector<CDevice *> {
+class CDeviceArena {
+	// Devices are allocated in blocks while parsing and all released by Clear.
+	static const size_t blockSize = 4096;
+	vector<CDevice *>	block_v;
+	size_t	used = blockSize;
+public:
+	~CDeviceArena() { Clear(); }
+	CDevice * New();
+	void Clear();
+	size_t MemorySize() { return ( block_v.size() * blockSize * sizeof(CDevice) ); }
+};
+
+class CDevicePtrVector : public vector<CDevice *> {  // devices are owned by CDeviceArena
 public:
 
 	~CDevicePtrVector();
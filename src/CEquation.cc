@@ -0,0 +1,65 @@
+/*
+ * CEquation.cc
+ *
+ * Copyright 2014-2018 D. Mitch Bailey  cvc at shuharisystem dot com
+ *
+ * This file is part of cvc.
+ *
+ * cvc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * cvc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with cvc.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * You can download cvc from https://github.com/d-m-bailey/cvc.git
+ */
+
+#include "CEquation.hh"
+
+CEquation::CEquation(const string & theEquation) {
+	list<string> * myTokenList_p;
+	if ( IsValidVoltage_(theEquation) ) {
+		myTokenList_p = new(list<string>);
+		myTokenList_p->push_back(theEquation);
+	} else {
+		myTokenList_p = postfix(theEquation);
+	}
+	reserve(myTokenList_p->size());
+	string	myOperators = "+-/*<>";
+	for ( auto token_pit = myTokenList_p->begin(); token_pit != myTokenList_p->end(); token_pit++ ) {
+		if ( myOperators.find(*token_pit) < myOperators.length() ) {
+			push_back(CEquationToken((*token_pit)[0]));
+			continue;
+		}
+		maxDepth++;
+		if ( isalpha((*token_pit)[0]) ) { // power or parameter name
+			push_back(CEquationToken(NAME_TOKEN));
+			back().text = *token_pit;
+			back().key = *token_pit;
+			toupper_(back().key);
+		} else if ( IsValidVoltage_(*token_pit) ) {
+			push_back(CEquationToken(NUMBER_TOKEN));
+			back().value = from_string<float>(*token_pit);
+		} else {
+			push_back(CEquationToken(INVALID_TOKEN));
+			back().text = *token_pit;
+		}
+	}
+	delete myTokenList_p;
+}
+
+const CEquation & CEquation::Compile(const string & theEquation) {
+	static unordered_map<string, CEquation> myEquationCache;
+	auto equation_pit = myEquationCache.find(theEquation);
+	if ( equation_pit == myEquationCache.end() ) {
+		equation_pit = myEquationCache.emplace(theEquation, CEquation(theEquation)).first;
+	}
+	return equation_pit->second;
+}
@@ -0,0 +1,74 @@
+/*
+ * CEquation.hh
+ *
+ * Copyright 2014-2018 D. Mitch Bailey  cvc at shuharisystem dot com
+ *
+ * This file is part of cvc.
+ *
+ * cvc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * cvc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with cvc.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * You can download cvc from https://github.com/d-m-bailey/cvc.git
+ */
+
+#ifndef CEQUATION_HH_
+#define CEQUATION_HH_
+
+#include "Cvc.hh"
+
+// token types other than the operators "+-/*<>"
+#define NUMBER_TOKEN	'#'
+#define NAME_TOKEN	'$'
+#define INVALID_TOKEN	'?'
+
+class CEquationToken {
+public:
+	char	type;
+	float	value = 0;
+	string	text; // name or invalid token as written
+	string	key; // upper case name for parameter lookup
+
+	CEquationToken(char theType) : type(theType) {}
+};
+
+// Power and resistance equation compiled once to postfix tokens.
+// Compiled equations are cached by text and shared by all callers.
+class CEquation : public vector<CEquationToken> {
+public:
+	size_t	maxDepth = 0; // upper bound on evaluation stack size
+
+	CEquation(const string & theEquation);
+	static const CEquation & Compile(const string & theEquation);
+};
+
+// Evaluation stack that only allocates for unusually long equations.
+template <typename T> class CEquationStack {
+	T	fixedStack[16];
+	vector<T>	largeStack_v;
+	T *	stack_p = fixedStack;
+	size_t	depth = 0;
+public:
+	CEquationStack(size_t theMaxDepth) {
+		if ( theMaxDepth > 16 ) {
+			largeStack_v.resize(theMaxDepth);
+			stack_p = largeStack_v.data();
+		}
+	}
+	inline void push_back(T theValue) { stack_p[depth++] = theValue; }
+	inline void pop_back() { depth--; }
+	inline T & back() { return stack_p[depth - 1]; }
+	inline T & front() { return stack_p[0]; }
+	inline size_t size() { return depth; }
+};
+
+#endif /* CEQUATION_HH_ */
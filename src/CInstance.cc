@@ -31,25 +31,30 @@
 
 int gHashCollisionCount;
 int gMaxHashLength;
+instanceId_t gParallelInstanceCount;  // collapsed instances and the devices/nets they would have expanded
+deviceId_t gParallelDeviceCount;
+netId_t gParallelNetCount;
  
 void CInstance::AssignTopGlobalIDs(CCvcDb * theCvcDb_p, CCircuit * theMaster_p) {
 
+	gHashCollisionCount = gMaxHashLength = 0;
+	gParallelInstanceCount = gParallelDeviceCount = gParallelNetCount = 0;
 	theMaster_p->instanceId_v.push_back(0);
 	theCvcDb_p->subcircuitCount = 1;
 	firstSubcircuitId = 1;
 	parentId = 0;
 	master_p = theMaster_p;
 	netId_t myLastNet = theMaster_p->localSignalIdMap.size();
-	localToGlobalNetId_v.reserve(myLastNet);
-	localToGlobalNetId_v.resize(myLastNet);
+	portNetId_v.reserve(myLastNet);  // top level local and global ids are the same
+	portNetId_v.resize(myLastNet);
 	theMaster_p->internalSignal_v.clear();
 	theMaster_p->internalSignal_v.reserve(theMaster_p->localSignalIdMap.size());
 	theMaster_p->internalSignal_v.resize(theMaster_p->localSignalIdMap.size());
-	for (CTextNetIdMap::iterator textNetIdPair_pit = theMaster_p->localSignalIdMap.begin(); textNetIdPair_pit != theMaster_p->localSignalIdMap.end(); textNetIdPair_pit++) {
+	for (CTextNetIdArray::iterator textNetIdPair_pit = theMaster_p->localSignalIdMap.begin(); textNetIdPair_pit != theMaster_p->localSignalIdMap.end(); textNetIdPair_pit++) {
 		theMaster_p->internalSignal_v[textNetIdPair_pit->second] = textNetIdPair_pit->first;
 	}
 	for (netId_t globalNet_it = 0; globalNet_it < myLastNet; globalNet_it++) {
-		localToGlobalNetId_v[globalNet_it] = globalNet_it;
+		portNetId_v[globalNet_it] = globalNet_it;
 	}
 	theCvcDb_p->netCount = myLastNet;
 	theCvcDb_p->subcircuitCount += theMaster_p->subcircuitPtr_v.size();
@@ -57,27 +62,41 @@ void CInstance::AssignTopGlobalIDs(CCvcDb * theCvcDb_p, CCircuit * theMaster_p)
 	theCvcDb_p->netParent_v.resize(theCvcDb_p->netCount, 0);
 	theCvcDb_p->deviceParent_v.resize(theCvcDb_p->deviceCount, 0);
 
-	instanceId_t myLastSubcircuitId = theMaster_p->subcircuitPtr_v.size();
-	instanceId_t myNewInstanceId;
-	for (instanceId_t subcircuit_it = 0; subcircuit_it < myLastSubcircuitId; subcircuit_it++) {
-		//if (theMaster_p->subcircuitPtr_v[subcircuit_it]->master_p->deviceCount > 0) {
-			myNewInstanceId = firstSubcircuitId + subcircuit_it;
-			CDevice * mySubcircuit_p = theMaster_p->subcircuitPtr_v[subcircuit_it];
-			if ( mySubcircuit_p->master_p->instanceId_v.size() == 0 ) mySubcircuit_p->master_p->AllocateInstances(theCvcDb_p, myNewInstanceId);
-			theCvcDb_p->instancePtr_v[myNewInstanceId] = new CInstance;
-			theCvcDb_p->instancePtr_v[myNewInstanceId]->AssignGlobalIDs(theCvcDb_p, myNewInstanceId, mySubcircuit_p, 0, this, NOT_PARALLEL);
-		//}
+	// depth first with an explicit stack. children are popped in order, so ids match the former recursive assignment.
+	vector<tuple<instanceId_t, CDevice *, instanceId_t, bool>> myPending_v;
+	PushSubcircuits(myPending_v, 0, NOT_PARALLEL);
+	while ( ! myPending_v.empty() ) {
+		instanceId_t myInstanceId = get<0>(myPending_v.back());
+		CDevice * mySubcircuit_p = get<1>(myPending_v.back());
+		instanceId_t myParentId = get<2>(myPending_v.back());
+		bool myIsParallel = get<3>(myPending_v.back());
+		myPending_v.pop_back();
+		CInstance * myInstance_p = theCvcDb_p->instancePtr_v[myInstanceId];
+		myIsParallel = myInstance_p->AssignGlobalIDs(theCvcDb_p, myInstanceId, mySubcircuit_p, myParentId, theCvcDb_p->instancePtr_v[myParentId], myIsParallel);
+		myInstance_p->PushSubcircuits(myPending_v, myInstanceId, myIsParallel);
 	}
 	theCvcDb_p->netParent_v.shrink_to_fit();
 	theCvcDb_p->deviceParent_v.shrink_to_fit();
 	theCvcDb_p->debugFile << "DEBUG: netParent size " << theCvcDb_p->netParent_v.size() << "; deviceParent size " << theCvcDb_p->deviceParent_v.size() << endl;
 	theCvcDb_p->debugFile << "DEBUG: parallel collisions " << gHashCollisionCount << " max length " << gMaxHashLength << endl;
+	if ( gParallelInstanceCount > 0 ) {
+		theCvcDb_p->reportFile << "Parallel instances: " << gParallelInstanceCount << " skipped " << gParallelDeviceCount << " devices "
+			<< gParallelNetCount << " nets" << endl;
+	}
+}
+
+void CInstance::PushSubcircuits(vector<tuple<instanceId_t, CDevice *, instanceId_t, bool>> & thePending_v, instanceId_t theInstanceId, bool isParallel) {
+	/// Adds the subcircuits of this instance in reverse order so that the first subcircuit is assigned next.
+	for (instanceId_t subcircuit_it = master_p->subcircuitPtr_v.size(); subcircuit_it > 0; subcircuit_it--) {
+		thePending_v.push_back(make_tuple(firstSubcircuitId + subcircuit_it - 1, master_p->subcircuitPtr_v[subcircuit_it - 1], theInstanceId, isParallel));
+	}
 }
 
-void CInstance::AssignGlobalIDs(CCvcDb * theCvcDb_p, const instanceId_t theInstanceId, CDevice * theSubcircuit_p, const instanceId_t theParentId,
+bool CInstance::AssignGlobalIDs(CCvcDb * theCvcDb_p, const instanceId_t theInstanceId, CDevice * theSubcircuit_p, const instanceId_t theParentId,
 		CInstance * theParent_p, bool isParallel) {
+	/// Assigns ids for this instance only. Returns true if nets and devices were not expanded because the instance is parallel.
 	master_p = theSubcircuit_p->master_p;
-	instanceId_t myLastSubcircuitId = master_p->subcircuitPtr_v.size();
+	if ( master_p->instanceId_v.size() == 0 ) master_p->AllocateInstances(theCvcDb_p, theInstanceId);
 	firstSubcircuitId = theCvcDb_p->subcircuitCount;
 	master_p->instanceId_v.push_back(theInstanceId);
 
@@ -96,8 +115,8 @@ void CInstance::AssignGlobalIDs(CCvcDb * theCvcDb_p, const instanceId_t theInsta
 		}
 		theCvcDb_p->debugFile << "DEBUG: found parallel instance in parallel instance at " << theCvcDb_p->HierarchyName(theInstanceId) << endl;
 	} else {
-		if ( theSubcircuit_p->signalId_v.size() <= theCvcDb_p->cvcParameters.cvcParallelCircuitPortLimit ) {
-			myParallelInstance = theSubcircuit_p->FindParallelInstance(theCvcDb_p, theInstanceId, theParent_p->localToGlobalNetId_v);
+		if ( master_p->CheckParallelInstances(theCvcDb_p->cvcParameters.cvcParallelCircuitPortLimit) ) {
+			myParallelInstance = theSubcircuit_p->FindParallelInstance(theCvcDb_p, theInstanceId, theParent_p);
 			if ( myParallelInstance == theInstanceId ) {
 				theCvcDb_p->instancePtr_v[theInstanceId]->parallelInstanceCount = 1;
 			} else {  // skip parallel circuits
@@ -105,6 +124,9 @@ void CInstance::AssignGlobalIDs(CCvcDb * theCvcDb_p, const instanceId_t theInsta
 				theCvcDb_p->debugFile << "DEBUG: found parallel instance at " << theCvcDb_p->HierarchyName(theInstanceId) << endl;
 				parallelInstanceId = myParallelInstance;
 				isParallel = true;
+				gParallelInstanceCount++;
+				gParallelDeviceCount += master_p->deviceCount;  // subtree totals. nested instances are not counted again
+				gParallelNetCount += master_p->netCount;
 			}
 		}
 	}
@@ -112,33 +134,22 @@ void CInstance::AssignGlobalIDs(CCvcDb * theCvcDb_p, const instanceId_t theInsta
 		firstNetId = theCvcDb_p->netCount;
 		firstDeviceId = theCvcDb_p->deviceCount;
 
-		netId_t myLastNet = master_p->localSignalIdMap.size();
-		localToGlobalNetId_v.reserve(myLastNet);
-		localToGlobalNetId_v.resize(myLastNet);
+		portNetId_v.reserve(master_p->portCount);
+		portNetId_v.resize(master_p->portCount);
 		for (netId_t net_it = 0; net_it < master_p->portCount; net_it++) {
-			localToGlobalNetId_v[net_it] = theParent_p->localToGlobalNetId_v[theSubcircuit_p->signalId_v[net_it]];
-		}
-		for (netId_t net_it = master_p->portCount; net_it < myLastNet; net_it++) {
-			localToGlobalNetId_v[net_it] = firstNetId + net_it - master_p->portCount;
+			portNetId_v[net_it] = theParent_p->LocalToGlobalNetId(theSubcircuit_p->signalId_v[net_it]);
 		}
+		parallel = ( master_p->localSignalIdMap.size() == 0 );  // empty instances are treated as parallel
 		theCvcDb_p->netCount += master_p->LocalNetCount();
 		theCvcDb_p->deviceCount += master_p->devicePtr_v.size();
 		theCvcDb_p->netParent_v.resize(theCvcDb_p->netCount, theInstanceId);
 		theCvcDb_p->deviceParent_v.resize(theCvcDb_p->deviceCount, theInstanceId);
+	} else {
+		parallel = true;
 	}
 
 	theCvcDb_p->subcircuitCount += master_p->subcircuitPtr_v.size();
-
-	instanceId_t myNewInstanceId;
-	for (instanceId_t subcircuit_it = 0; subcircuit_it < myLastSubcircuitId; subcircuit_it++) {
-		myNewInstanceId = firstSubcircuitId + subcircuit_it;
-		CDevice * mySubcircuit_p = master_p->subcircuitPtr_v[subcircuit_it];
-		//if (mySubcircuit_p->master_p->deviceCount > 0) {
-			if ( mySubcircuit_p->master_p->instanceId_v.size() == 0 ) mySubcircuit_p->master_p->AllocateInstances(theCvcDb_p, myNewInstanceId);
-			theCvcDb_p->instancePtr_v[myNewInstanceId] = new CInstance;
-			theCvcDb_p->instancePtr_v[myNewInstanceId]->AssignGlobalIDs(theCvcDb_p, myNewInstanceId, mySubcircuit_p, theInstanceId, this, isParallel);
-		//}
-	}
+	return isParallel;
 }
 
 void CInstance::Print (const instanceId_t theInstanceId, const string theIndentation) {
@@ -149,16 +160,24 @@ void CInstance::Print (const instanceId_t theInstanceId, const string theIndenta
 	cout << "  device: " << firstDeviceId << endl;
 	cout << myIndentation << "parent: " << parentId << "  master: " << master_p->name << endl;
 	cout << myIndentation << "signal map:";
-	for (netId_t net_it = 0; net_it < localToGlobalNetId_v.size(); net_it++) {
-		cout << " " << net_it << ":" << localToGlobalNetId_v[net_it];
+	for (netId_t net_it = 0; net_it < portNetId_v.size(); net_it++) {
+		cout << " " << net_it << ":" << portNetId_v[net_it];
 	}
 	cout << endl;
 }
 
-void CInstancePtrVector::Clear() {
-	for ( auto instance_ppit = begin(); instance_ppit != end(); instance_ppit++ ) {
-		delete (*instance_ppit);
+void CInstancePtrVector::Allocate(instanceId_t theInstanceCount) {
+	Clear();
+	pool_p = new CInstance[theInstanceCount];
+	reserve(theInstanceCount);
+	for ( instanceId_t instance_it = 0; instance_it < theInstanceCount; instance_it++ ) {
+		push_back(pool_p + instance_it);
 	}
+}
+
+void CInstancePtrVector::Clear() {
+	delete [] pool_p;
+	pool_p = NULL;
 	resize(0);
 }
 
@@ -27,6 +27,7 @@
 #include "Cvc.hh"
 
 #include <unordered_map>
+#include <tuple>
 #include "CCircuit.hh"
 
 class CCvcDb;
@@ -41,28 +42,30 @@ public:
 		instanceId_t  parallelInstanceId;  // for parallel instances deleted
 	};
 
-	CNetIdVector	localToGlobalNetId_v;
+	CNetIdVector	portNetId_v;  // global ids of ports. internal nets are consecutive from firstNetId (top instance maps all nets)
 
-	/* The CInstance structure also doubles as a hash.
-	   Each master has a vector of instances.
-	*/
-	instanceId_t	nextHashedInstanceId = UNKNOWN_DEVICE;
- 
 	instanceId_t	parentId = 0;
 	CCircuit * master_p = NULL;
 	bool	isMasked = false;
+	bool	parallel = false;  // parallel or empty instance. devices and nets are not expanded
 
 	void AssignTopGlobalIDs(CCvcDb * theCvcDb_p, CCircuit * theMaster_p);
-	void AssignGlobalIDs(CCvcDb * theCvcDb_p, const instanceId_t theInstanceId, CDevice * theSubcircuit_p, const instanceId_t theParentId,
-		CInstance * theParent_p, bool isParallel);
-	bool IsParallelInstance() { return (localToGlobalNetId_v.size() == 0); };
+	bool AssignGlobalIDs(CCvcDb * theCvcDb_p, const instanceId_t theInstanceId, CDevice * theSubcircuit_p, const instanceId_t theParentId,
+		CInstance * theParent_p, bool isParallel);
+	void PushSubcircuits(vector<tuple<instanceId_t, CDevice *, instanceId_t, bool>> & thePending_v, instanceId_t theInstanceId, bool isParallel);
+	bool IsParallelInstance() { return (parallel); };
+	inline netId_t LocalToGlobalNetId(netId_t theLocalNetId) {
+		return ( theLocalNetId < portNetId_v.size() ) ? portNetId_v[theLocalNetId] : firstNetId + theLocalNetId - netId_t(portNetId_v.size());
+	}
 
 	void Print(const instanceId_t theInstanceId, const string theIndentation = "");
 };
 
 class CInstancePtrVector : public vector<CInstance *> {
+	CInstance *	pool_p = NULL;  // all instances are allocated together
 public:
 	~CInstancePtrVector();
+	void Allocate(instanceId_t theInstanceCount);
 	void Clear();
 };
 
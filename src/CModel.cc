@@ -124,12 +124,12 @@ CModel::CModel(string theParameterString) {
 	}
 }
 
-bool CModel::ParameterMatch(CParameterMap& theParameterMap, text_t theCellName) {
+bool CModel::ParameterMatch(const CParameterMap& theParameterMap, text_t theCellName) {
 	CNormalValue myCheckValue;
 
 	for (CConditionPtrList::iterator condition_ppit = conditionPtrList.begin(); condition_ppit != conditionPtrList.end(); condition_ppit++) {
 		try {
-			myCheckValue = theParameterMap.at((*condition_ppit)->parameter);
+			myCheckValue = theParameterMap.at((*condition_ppit)->parameter).NumericValue();
 			if ( ! (*condition_ppit)->CheckCondition(myCheckValue) ) return (false);
 		}
 		catch (const out_of_range& oor_exception) {
@@ -289,6 +289,12 @@ void CModelListMap::Clear() {
 		}
 		erase(begin());
 	}
+	ClearParameterCache();
+}
+
+void CModelListMap::ClearParameterCache() {
+	CTextParameterMap().swap(parameterCache);
+	CTextModelPtrMap().swap(modelMatchCache);
 }
 
 void CModelListMap::AddModel(string theParameterString) {
@@ -306,6 +312,7 @@ void CModelListMap::AddModel(string theParameterString) {
 			(*this)[myModelKey].push_back(myNewModel);
 			(*this)[myModelKey].vthDefinition = myNewModel.vthDefinition;
 		}
+		if ( myNewModel.cellFilterRegex_p ) (*this)[myModelKey].hasCellFilter = true;
 	}
 	catch (EModelError & myError) {
 		cout << myError.what() << endl;
@@ -320,16 +327,24 @@ void CModelListMap::AddModel(string theParameterString) {
 
 CModel * CModelListMap::FindModel(text_t theCellName, text_t theParameterText, CTextResistanceMap& theParameterResistanceMap, ostream& theLogFile) {
 	// FindModel: Set the model type based on theParameterText. Also adds entry to theParameterResistanceMap.
+	// Matches are cached by parameter text, so caches must be cleared with theParameterResistanceMap.
+	auto match_pit = modelMatchCache.find(theParameterText);
+	if ( match_pit != modelMatchCache.end() ) return match_pit->second;
 	string	myParameterString = trim_(string(theParameterText));
 	string	myModelKey = myParameterString.substr(0, myParameterString.find(" ", 2));
 	try {
-		CParameterMap myParameterMap;
-		if ( myParameterString.length() > myModelKey.length() ) {
-			// if there are parameters besides the model name
-			myParameterMap.CreateParameterMap(myParameterString.substr(myModelKey.length() + 1));
+		CModelList & myModelList = this->at(myModelKey);
+		auto parameter_pit = parameterCache.find(theParameterText);
+		if ( parameter_pit == parameterCache.end() ) {
+			parameter_pit = parameterCache.emplace(theParameterText, CParameterMap()).first;
+			if ( myParameterString.length() > myModelKey.length() ) {
+				// if there are parameters besides the model name
+				parameter_pit->second.CreateParameterMap(myParameterString.substr(myModelKey.length() + 1));
+			}
 		}
-		CModelList::iterator myLastModel = this->at(myModelKey).end();
-		for (CModelList::iterator model_pit = this->at(myModelKey).begin(); model_pit != myLastModel; model_pit++) {
+		CParameterMap & myParameterMap = parameter_pit->second;
+		CModelList::iterator myLastModel = myModelList.end();
+		for (CModelList::iterator model_pit = myModelList.begin(); model_pit != myLastModel; model_pit++) {
 			if ( model_pit->ParameterMatch(myParameterMap, theCellName) ) {
 				switch (model_pit->type) {
 				// TODO: do not recalculate if already exists
@@ -348,9 +363,11 @@ CModel * CModelListMap::FindModel(text_t theCellName, text_t theParameterText, C
 					default: theParameterResistanceMap[theParameterText] = 1;
 				}
 
+				if ( ! myModelList.hasCellFilter ) modelMatchCache[theParameterText] = &(*model_pit);
 				return &(*model_pit);
 			}
 		}
+		if ( ! myModelList.hasCellFilter ) modelMatchCache[theParameterText] = NULL;
 		return (NULL);
 	}
 	catch (const out_of_range& oor_exception) {
@@ -358,6 +375,17 @@ CModel * CModelListMap::FindModel(text_t theCellName, text_t theParameterText, C
 	}
 }
 
+string CModelListMap::CellFilterKey() {
+	// CellFilterKey: Identify the cell filtered models. Circuit merging depends on these filters.
+	string	myKey = "";
+	for ( auto modelList_pit = begin(); modelList_pit != end(); modelList_pit++ ) {
+		for ( auto model_pit = modelList_pit->second.begin(); model_pit != modelList_pit->second.end(); model_pit++ ) {
+			if ( model_pit->cellFilterRegex_p ) myKey += modelList_pit->first + " " + model_pit->cellFilter + "\n";
+		}
+	}
+	return myKey;
+}
+
 CModelList * CModelListMap::FindModelList(string theModelName) {
 	// FindModelList: Return a pointer to the first model list for theModelName
 	//
@@ -98,7 +98,7 @@ public:
 	CModel(string theParameterString);
 	void Clear();
 	size_t ModelCount();
-	bool ParameterMatch(CParameterMap& theParameterMap,text_t theCellName);
+	bool ParameterMatch(const CParameterMap& theParameterMap,text_t theCellName);
 	void CreateConditions(string theConditionString);
 	void SetDiodes (string theDiodeString);
 
@@ -110,6 +110,7 @@ class CModelList : public list<CModel> {
 public:
 	int		Vth = UNKNOWN_VOLTAGE;
 	string	vthDefinition;
+	bool	hasCellFilter = false; // model matches depend on cell name
 };
 
 class CTextModelPtrMap : public unordered_map<text_t, CModel *> {
@@ -121,11 +122,15 @@ class CModelListMap : public map<string, CModelList> {
 public:
 	bool hasError;
 	string filename;
+	CTextParameterMap	parameterCache; // parsed parameters by device parameter text
+	CTextModelPtrMap	modelMatchCache; // matched model by device parameter text, unless cell filtered
 
 	void Clear();
+	void ClearParameterCache();
 	void AddModel(string theParameterString);
 	CModel * FindModel(text_t theCellName, text_t theParameterText, CTextResistanceMap & theParameterResistanceMap, ostream& theLogFile);
 	CModelList * FindModelList(string theModelName);
+	string CellFilterKey();
 	void Print(ostream & theLogFile, string theIndentation = "");
 	void DebugPrint(string theIndentation = "");
 	returnCode_t SetVoltageTolerances(teestream & theReportFile, CPowerPtrMap & thePowerMacroPtrMap);
@@ -23,25 +23,30 @@
 
 #include "CNormalValue.hh"
 
+#include <chrono>
+
 CNormalValue::CNormalValue(string theStringValue) {
-	string myStringValue = trim_(theStringValue);
-	size_t myUnitOffset = myStringValue.find_first_not_of("-+0123456789.eE");
-	if ( myUnitOffset > myStringValue.length() ) myUnitOffset = myStringValue.length();
-	double	myRealValue = from_string<double>(myStringValue.substr(0, myUnitOffset));
-
-	switch ( myStringValue[myUnitOffset] ) {
-		case 'G': {	myRealValue *= pow(10, 9); break; }
-		case 'M': {	myRealValue *= pow(10, 6); break; }
-		case 'K': {	myRealValue *= pow(10, 3); break; }
-		case 'k': {	myRealValue *= pow(10, 3); break; }
-		case 'm': {	myRealValue *= pow(10, -3); break; }
-		case 'u': {	myRealValue *= pow(10, -6); break; }
-		case 'n': {	myRealValue *= pow(10, -9); break; }
-		case 'p': {	myRealValue *= pow(10, -12); break; }
-		case 'f': {	myRealValue *= pow(10, -15); break; }
+	const char * myText = theStringValue.c_str();
+	while ( isspace(*myText) ) myText++;
+	double	myRealValue;
+	const char * myUnit = ParseNumber(myText, myRealValue);
+	if ( myUnit == NULL ) myUnit = myText + strspn(myText, "-+0123456789.eE");  // value is 0
+	char mySuffix = *myUnit;
+	if ( theStringValue.find_first_not_of(" \t\n", myUnit - theStringValue.c_str()) == string::npos ) mySuffix = '\0';  // trailing space
+
+	switch ( mySuffix ) {
+		case 'G': {	myRealValue *= 1e9; break; }
+		case 'M': {	myRealValue *= 1e6; break; }
+		case 'K': {	myRealValue *= 1e3; break; }
+		case 'k': {	myRealValue *= 1e3; break; }
+		case 'm': {	myRealValue *= 1e-3; break; }
+		case 'u': {	myRealValue *= 1e-6; break; }
+		case 'n': {	myRealValue *= 1e-9; break; }
+		case 'p': {	myRealValue *= 1e-12; break; }
+		case 'f': {	myRealValue *= 1e-15; break; }
 		case '\0': break;
 		default: {
-			throw EFatalError("unknown suffix on parameter: " + myStringValue);
+			throw EFatalError("unknown suffix on parameter: " + theStringValue);
 		}
 	}
 	while ( abs(myRealValue * pow(10, - scale)) < 1e6 && scale > -21 ) {
@@ -165,3 +170,118 @@ void CNormalValue::TestFunction() {
 
 }
 
+struct CParseTestCase {
+	const char *	text;
+	bool	intOutOfRange;
+	int	intValue;
+	bool	doubleOutOfRange;
+	double	doubleValue;
+	bool	isValidVoltage;
+};
+
+// Results of the earlier stringstream from_string and sscanf IsValidVoltage_ except where noted.
+static const CParseTestCase parseTestCase_v[] = {
+	{"0", false, 0, false, 0, true},
+	{"1", false, 1, false, 1, true},
+	{"-1", false, -1, false, -1, true},
+	{"+7", false, 7, false, 7, true},
+	{"12k", false, 12000, false, 12000, true},
+	{"1.5", true, 0, false, 1.5, true},
+	{"1.5u", true, 0, false, 1.5e-6, true},
+	{"-2.25m", true, 0, false, -2.25e-3, true},
+	{" 3 ", false, 3, false, 3, true},
+	{"3 k", false, 3000, false, 3000, false},
+	{"1e3", true, 0, false, 1000, false},
+	{"1E-6", true, 0, false, 1e-6, false},
+	{"2.5e+2n", true, 0, false, 2.5e-7, false},
+	{"abc", false, 0, false, 0, false},
+	{"", false, 0, false, 0, false},  // was uninitialized
+	{".5", false, 0, false, 0.5, false},
+	{"5.", true, 0, false, 5, false},
+	{"-.5u", false, 0, false, -5e-7, false},
+	{"1meg", true, 0, true, 0, false},
+	{"1 x", true, 0, true, 0, false},
+	{"4294967296", false, INT_MAX, false, 4294967296.0, true},
+	{"99999999999", false, INT_MAX, false, 99999999999.0, true},
+	{"-4294967295", false, INT_MIN, false, -4294967295.0, true},
+	{"2147483648", false, INT_MAX, false, 2147483648.0, true},
+	{"-2147483648", false, INT_MIN, false, -2147483648.0, true},
+	{"1.8", true, 0, false, 1.8, true},
+	{"0.05", true, 0, false, 0.05, true},
+	{"1e400", true, 0, false, numeric_limits<double>::max(), false},
+	{"-1e400", true, 0, false, - numeric_limits<double>::max(), false},
+	{"1.2.3", true, 0, true, 0, false},
+	{"12K extra", false, 12000, false, 12000, false},
+	{"007", false, 7, false, 7, true},
+	{"0x10", true, 0, true, 0, false},
+	{"1e", true, 0, false, 0, false},
+	{"1e+", true, 0, false, 0, false},
+	{"3.3E", true, 0, false, 0, true},
+	{"--5", false, 0, false, 0, false},  // was a valid voltage
+	{"+ 5", false, 0, false, 0, false},  // was a valid voltage
+};
+
+void CNormalValue::TestParseFunction() {
+	// Compares from_string and IsValidVoltage_ with the expected results.
+	int myFailCount = 0;
+	for ( const CParseTestCase & myCase : parseTestCase_v ) {
+		string myText = myCase.text;
+		bool myOutOfRange = false;
+		int myIntValue = 0;
+		try {
+			myIntValue = from_string<int>(myText);
+		}
+		catch (const out_of_range& exception) {
+			myOutOfRange = true;
+		}
+		if ( myOutOfRange != myCase.intOutOfRange || ( ! myOutOfRange && myIntValue != myCase.intValue ) ) {
+			cout << "Test parse '" << myText << "' int " << ( myOutOfRange ? "out of range" : to_string<int>(myIntValue) ) << " expected "
+				<< ( myCase.intOutOfRange ? "out of range" : to_string<int>(myCase.intValue) ) << endl;
+			myFailCount++;
+		}
+		myOutOfRange = false;
+		double myDoubleValue = 0;
+		try {
+			myDoubleValue = from_string<double>(myText);
+		}
+		catch (const out_of_range& exception) {
+			myOutOfRange = true;
+		}
+		// suffix scales are float, so compare with float precision
+		if ( myOutOfRange != myCase.doubleOutOfRange
+				|| ( ! myOutOfRange && abs(myDoubleValue - myCase.doubleValue) > abs(myCase.doubleValue) * 1e-6 ) ) {
+			cout << "Test parse '" << myText << "' double " << ( myOutOfRange ? "out of range" : to_string<double>(myDoubleValue) ) << " expected "
+				<< ( myCase.doubleOutOfRange ? "out of range" : to_string<double>(myCase.doubleValue) ) << endl;
+			myFailCount++;
+		}
+		bool myIsValid = IsValidVoltage_(myText);
+		if ( myIsValid != myCase.isValidVoltage ) {
+			cout << "Test parse '" << myText << "' valid voltage " << myIsValid << " expected " << myCase.isValidVoltage << endl;
+			myFailCount++;
+		}
+	}
+	cout << "Test parse " << sizeof(parseTestCase_v) / sizeof(parseTestCase_v[0]) << " cases " << myFailCount << " failures" << endl;
+}
+
+void CNormalValue::BenchmarkParseFunction(int theIterations) {
+	// Time per call for typical netlist and power file values.
+	const vector<string> myValue_v = {"1.5", "0.18u", "3.3", "-1.2", "1.8", "2k", "0.05", "12"};
+	double myCheckSum = 0;
+	auto myStart = chrono::steady_clock::now();
+	for ( int iteration_it = 0; iteration_it < theIterations; iteration_it++ ) {
+		myCheckSum += from_string<float>(myValue_v[iteration_it & 7]);
+	}
+	auto myFromStringEnd = chrono::steady_clock::now();
+	for ( int iteration_it = 0; iteration_it < theIterations; iteration_it++ ) {
+		myCheckSum += IsValidVoltage_(myValue_v[iteration_it & 7]);
+	}
+	auto myValidEnd = chrono::steady_clock::now();
+	for ( int iteration_it = 0; iteration_it < theIterations; iteration_it++ ) {
+		myCheckSum += CNormalValue(myValue_v[iteration_it & 7]).scale;
+	}
+	auto myNormalEnd = chrono::steady_clock::now();
+	cout << "Benchmark from_string<float> " << chrono::duration<double, nano>(myFromStringEnd - myStart).count() / theIterations << "ns";
+	cout << " IsValidVoltage_ " << chrono::duration<double, nano>(myValidEnd - myFromStringEnd).count() / theIterations << "ns";
+	cout << " CNormalValue " << chrono::duration<double, nano>(myNormalEnd - myValidEnd).count() / theIterations << "ns";
+	cout << " (checksum " << myCheckSum << ")" << endl;
+}
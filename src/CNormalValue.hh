@@ -40,6 +40,8 @@ public:
 
 	static void Test(string theFirstValue, string theSecondValue);
 	static void TestFunction();
+	static void TestParseFunction();
+	static void BenchmarkParseFunction(int theIterations = 1000000);
 	short int Compare(string stringValue);
 	float RealValue();
 
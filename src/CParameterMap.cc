@@ -23,6 +23,17 @@
 
 #include "CParameterMap.hh"
 
+CParameterValue::CParameterValue(const string & theText) {
+	text = theText;
+	try {
+		numericValue = CNormalValue(theText);
+		realValue = numericValue.RealValue();
+		isNumeric = true;
+	}
+	catch (const EFatalError & myError) {  // reported if used in a condition or equation
+	}
+}
+
 void CParameterMap::CreateParameterMap(string theParameterString) {
 	string myParameterName;
 	string myParameterValue;
@@ -37,7 +48,7 @@ void CParameterMap::CreateParameterMap(string theParameterString) {
 			if ( myParameterName[0] == '$' ) myParameterName = myParameterName.substr(1);
 			toupper_(myParameterName);
 			myParameterValue = theParameterString.substr(myEqualIndex + 1, myStringEnd - (myEqualIndex + 1));
-			(*this)[myParameterName] = myParameterValue;
+			(*this)[myParameterName] = CParameterValue(myParameterValue);
 			myStringBegin = myStringEnd + 1;
 		} while (myStringEnd < theParameterString.length());
 	}
@@ -48,58 +59,50 @@ void CParameterMap::Print(string theIndentation, string theHeading) {
 	cout << theIndentation << theHeading << endl;
 	cout << myIndentation << "Parameters:";
 	for (CParameterMap::iterator parameterPair_pit = begin(); parameterPair_pit != end(); parameterPair_pit++) {
-		cout << " " << parameterPair_pit->first << ":" << parameterPair_pit->second;
+		cout << " " << parameterPair_pit->first << ":" << parameterPair_pit->second.text;
 	}
 	cout << endl;
 }
 
-resistance_t CParameterMap::CalculateResistance(string theEquation) {
-	list<string> * myTokenList_p;
-	// exceptions cause memory leaks
-	if ( IsValidVoltage_(theEquation) ) {
-		myTokenList_p = new(list<string>);
-		myTokenList_p->push_back(theEquation);
-	} else {
-		myTokenList_p = postfix(theEquation);
-	}
-	list<double> myResistanceStack;
+resistance_t CParameterMap::CalculateResistance(const string & theEquation) {
+	const CEquation & myEquation = CEquation::Compile(theEquation);
+	CEquationStack<double> myResistanceStack(myEquation.maxDepth);
 	double	myResistance;
-	string	myOperators = "+-/*<>";
-	for ( auto token_pit = myTokenList_p->begin(); token_pit != myTokenList_p->end(); token_pit++ ) {
-		if ( myOperators.find(*token_pit) < myOperators.length() ) {
-			if ( myResistanceStack.size() < 2 ) throw EPowerError("invalid equation: " + theEquation);
-			myResistance = myResistanceStack.back();
-			myResistanceStack.pop_back();
-			if ( *token_pit == "+" ) {
-				myResistanceStack.back() += myResistance;
-			} else if ( *token_pit == "-" ) {
-				myResistanceStack.back() -= myResistance;
-			} else if ( *token_pit == "*" ) {
-				myResistanceStack.back() *= myResistance;
-			} else if ( *token_pit == "/" ) {
-				myResistanceStack.back() /= myResistance;
-			} else if ( *token_pit == "<" ) {
-				myResistanceStack.back() = min(myResistanceStack.back(), myResistance);
-			} else if ( *token_pit == ">" ) {
-				myResistanceStack.back() = max(myResistanceStack.back(), myResistance);
-			} else throw EPowerError("invalid operator: " + *token_pit);
-		} else if ( isalpha((*token_pit)[0]) ) { // parameter name
-			string myParameter = *token_pit;
-			toupper_(myParameter);
-			if ( this->count(myParameter) > 0 ) { // parameter definition exists
-				CNormalValue myParameterValue((*this)[myParameter]);
-				myResistanceStack.push_back(myParameterValue.RealValue());
-			} else {
-				throw EResistanceError("missing parameter: " + *token_pit + " in " + theEquation);
+	for ( auto token_pit = myEquation.begin(); token_pit != myEquation.end(); token_pit++ ) {
+		switch ( token_pit->type ) {
+			case NAME_TOKEN: { // parameter name
+				auto parameter_pit = find(token_pit->key);
+				if ( parameter_pit != end() ) { // parameter definition exists
+					parameter_pit->second.NumericValue();  // non-numeric values throw
+					myResistanceStack.push_back(parameter_pit->second.realValue);
+				} else {
+					throw EResistanceError("missing parameter: " + token_pit->text + " in " + theEquation);
+				}
+				break;
+			}
+			case NUMBER_TOKEN: {
+				myResistanceStack.push_back(token_pit->value);
+				break;
+			}
+			case INVALID_TOKEN: {
+				throw EResistanceError("invalid resistance calculation token: " + token_pit->text + " in " + theEquation);
+			}
+			default: {
+				if ( myResistanceStack.size() < 2 ) throw EPowerError("invalid equation: " + theEquation);
+				myResistance = myResistanceStack.back();
+				myResistanceStack.pop_back();
+				switch ( token_pit->type ) {
+					case '+': { myResistanceStack.back() += myResistance; break; }
+					case '-': { myResistanceStack.back() -= myResistance; break; }
+					case '*': { myResistanceStack.back() *= myResistance; break; }
+					case '/': { myResistanceStack.back() /= myResistance; break; }
+					case '<': { myResistanceStack.back() = min(myResistanceStack.back(), myResistance); break; }
+					case '>': { myResistanceStack.back() = max(myResistanceStack.back(), myResistance); break; }
+				}
 			}
-		} else if ( IsValidVoltage_(*token_pit) ) {
-			myResistanceStack.push_back(from_string<float>(*token_pit));
-		} else {
-			throw EResistanceError("invalid resistance calculation token: " + *token_pit + " in " + theEquation);
 		}
 	}
-	if ( myResistanceStack.size() != 1 ) EResistanceError("invalid equation: " + theEquation);
-	delete myTokenList_p;
+	if ( myResistanceStack.size() != 1 ) throw EResistanceError("invalid equation: " + theEquation);
 	if ( myResistanceStack.front() >= MAX_RESISTANCE ) {
 		return ( MAX_RESISTANCE );
 	} else {
@@ -27,12 +27,36 @@
 #include "Cvc.hh"
 
 #include "CNormalValue.hh"
+#include "CEquation.hh"
 
-class CParameterMap : public map<string, string> {
+// Parameter value parsed once when the parameter map is created.
+// Non-numeric values are kept as text and only rejected when used numerically.
+class CParameterValue {
+public:
+	string	text;
+	CNormalValue	numericValue;
+	float	realValue = 0;
+	bool	isNumeric = false;
+
+	CParameterValue() {}
+	CParameterValue(const string & theText);
+	inline const CNormalValue & NumericValue() const {
+		if ( ! isNumeric ) throw EFatalError("unknown suffix on parameter: " + text);
+		return numericValue;
+	}
+};
+
+class CParameterMap : public map<string, CParameterValue> {
 public:
 	void CreateParameterMap(string theParameterString);
-	resistance_t CalculateResistance(string theEquation);
+	resistance_t CalculateResistance(const string & theEquation);
 	void Print(string theIndentation = "", string theHeading = "");
 };
 
+// Parsed parameters for each unique device parameter text.
+class CTextParameterMap : public unordered_map<text_t, CParameterMap> {
+public:
+	CTextParameterMap(float theLoadFactor = DEFAULT_LOAD_FACTOR) {max_load_factor(theLoadFactor);}
+};
+
 #endif /* CPARAMETERMAP_HH_ */
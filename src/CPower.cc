@@ -28,6 +28,7 @@
 
 netId_t CPower::powerCount = 0;
 CFixedText CPower::powerDefinitionText;
+CPowerPool CPower::powerPool;
 
 CExtraPowerData::CExtraPowerData() {
 	powerSignal = CPower::powerDefinitionText.BlankTextAddress();
@@ -265,6 +266,67 @@ CPower::~CPower() {
 	if ( extraData ) delete extraData;
 }
 
+CPowerPool::~CPowerPool() {
+	for ( auto slab_pit = slab_v.begin(); slab_pit != slab_v.end(); slab_pit++ ) {
+		free(*slab_pit);
+	}
+}
+
+void * CPowerPool::Allocate(size_t theSize) {
+	if ( slotSize == 0 ) {
+		slotSize = max(theSize, max(sizeof(void *), sizeof(uint32_t)));
+		for ( slabAlignment = 1; slabAlignment < slotSize * slabSize; slabAlignment <<= 1 );
+	}
+	assert(theSize <= slotSize);
+	liveCount++;
+	if ( freeList_p ) {
+		void * myObject_p = freeList_p;
+		freeList_p = *static_cast<void **>(freeList_p);
+		return myObject_p;
+	}
+	if ( nextSlot == slabSize ) {
+		void * mySlab_p;
+		if ( posix_memalign(&mySlab_p, slabAlignment, slotSize * slabSize) != 0 ) throw bad_alloc();
+		*static_cast<uint32_t *>(mySlab_p) = slab_v.size();  // slot 0 is slab index
+		slab_v.push_back(static_cast<char *>(mySlab_p));
+		nextSlot = 1;
+	}
+	return slab_v.back() + slotSize * nextSlot++;
+}
+
+void CPowerPool::Free(void * theObject_p) {
+	if ( ! theObject_p ) return;
+	*static_cast<void **>(theObject_p) = freeList_p;
+	freeList_p = theObject_p;
+	liveCount--;
+}
+
+void CPowerPool::Release() {
+	// destroy remaining objects (frees extra data), then free all slabs.
+	if ( liveCount > 0 ) {
+		vector<char *> myFree_v;
+		for ( void * free_p = freeList_p; free_p; free_p = *static_cast<void **>(free_p) ) {
+			myFree_v.push_back(static_cast<char *>(free_p));
+		}
+		sort(myFree_v.begin(), myFree_v.end());
+		for ( size_t slab_it = 0; slab_it < slab_v.size(); slab_it++ ) {
+			size_t mySlotCount = ( slab_it + 1 == slab_v.size() ) ? nextSlot : slabSize;
+			for ( size_t slot_it = 1; slot_it < mySlotCount; slot_it++ ) {
+				char * mySlot_p = slab_v[slab_it] + slotSize * slot_it;
+				if ( binary_search(myFree_v.begin(), myFree_v.end(), mySlot_p) ) continue;
+				reinterpret_cast<CPower *>(mySlot_p)->~CPower();
+			}
+		}
+	}
+	for ( auto slab_pit = slab_v.begin(); slab_pit != slab_v.end(); slab_pit++ ) {
+		free(*slab_pit);
+	}
+	slab_v.clear();
+	freeList_p = NULL;
+	nextSlot = slabSize;
+	liveCount = 0;
+}
+
 void CPower::SetPowerAlias(string thePowerString, size_t theAliasStart) {
 	size_t myLastHierarchy = string(powerSignal()).find_last_of(HIERARCHY_DELIMITER);
 	string myPowerAlias = "";
@@ -672,13 +734,7 @@ CPower * CPowerPtrList::FindCalculatedPower(CEventQueue& theEventQueue, CPower *
 void CPowerPtrVector::ResetPowerPointerVector(size_t theSize) {
 	this->clear();
 	this->reserve(theSize);
-	this->resize(theSize);
-	for ( size_t index_it = 0; index_it < theSize; index_it++ ) {
-		(*this)[index_it].full = NULL;
-	}
-	this->powerPtrType_v.clear();
-	this->powerPtrType_v.reserve(theSize);
-	this->powerPtrType_v.resize(theSize, UNKNOWN_POWER_PTR);
+	this->resize(theSize);  // handles default to NULL
 }
 
 void CPowerPtrVector::CalculatePower(CEventQueue& theEventQueue, voltage_t theShortVoltage, netId_t theNetId, netId_t theDefaultNetId, CCvcDb * theCvcDb_p, string theCalculation) {
@@ -691,7 +747,9 @@ void CPowerPtrVector::CalculatePower(CEventQueue& theEventQueue, voltage_t theSh
 		if ( myDefaultPower_p->type[HIZ_BIT] ) {
 			myPower_p->type[HIZ_BIT] = true;
 		}
-		if ( myDefaultPower_p->extraData ) {
+		if ( myDefaultPower_p->extraData
+				&& ( myPower_p->extraData || ! IsEmpty(myDefaultPower_p->family()) || ! IsEmpty(myDefaultPower_p->implicitFamily())
+					|| ! myDefaultPower_p->extraData->relativeSet.empty() ) ) {  // calculated power only needs extra data for families
 			if ( ! myPower_p->extraData ) myPower_p->extraData = new CExtraPowerData;
 			myPower_p->extraData->family = myDefaultPower_p->family();
 			myPower_p->extraData->implicitFamily = myDefaultPower_p->implicitFamily();
@@ -870,94 +928,77 @@ string CPowerPtrMap::CalculateExpectedValue(string theEquation, netStatus_t theT
 }
 
 #define UNKNOWN_TOKEN (float(MAX_VOLTAGE) * 2)
-voltage_t CPowerPtrMap::CalculateVoltage(string theEquation, netStatus_t theType, CModelListMap & theModelListMap, bool thePermitUndefinedFlag, bool theResetImplicitFlag) {
+voltage_t CPowerPtrMap::CalculateVoltage(const string & theEquation, netStatus_t theType, CModelListMap & theModelListMap, bool thePermitUndefinedFlag, bool theResetImplicitFlag) {
 	if ( theResetImplicitFlag) implicitFamily = "";
-	list<string> * myTokenList_p;
-	// exceptions cause memory leaks
-	if ( IsValidVoltage_(theEquation) ) {
-		myTokenList_p = new(list<string>);
-		myTokenList_p->push_back(theEquation);
-	} else {
-		myTokenList_p = postfix(theEquation);
-	}
-	list<float> myVoltageStack;
+	const CEquation & myEquation = CEquation::Compile(theEquation);
+	CEquationStack<float> myVoltageStack(myEquation.maxDepth);
 	float	myVoltage;
-	string	myOperators = "+-/*<>";
-	for ( auto token_pit = myTokenList_p->begin(); token_pit != myTokenList_p->end(); token_pit++ ) {
-		if ( myOperators.find(*token_pit) < myOperators.length() ) {
-			if ( myVoltageStack.size() < 2 ) throw EPowerError("invalid equation: " + theEquation);
-			myVoltage = myVoltageStack.back();
-			myVoltageStack.pop_back();
-			if ( myVoltage == UNKNOWN_TOKEN ) {
-				if ( ( *token_pit == "<" ) || ( *token_pit == ">" ) ) {  // min/max keep value on stack
-					;
-				} else {  // arithmetic with invalid values gives invalid value
-					myVoltageStack.back() = UNKNOWN_TOKEN;
-				}
-			} else if ( myVoltageStack.back() == UNKNOWN_TOKEN ) {
-				if ( ( *token_pit == "<" ) || ( *token_pit == ">" ) ) {  // min/max replace with last voltage
-					myVoltageStack.back() = myVoltage;
-				}
-			} else if ( *token_pit == "+" ) {
-				myVoltageStack.back() += myVoltage;
-			} else if ( *token_pit == "-" ) {
-				myVoltageStack.back() -= myVoltage;
-			} else if ( *token_pit == "*" ) {
-				myVoltageStack.back() *= myVoltage;
-			} else if ( *token_pit == "/" ) {
-				myVoltageStack.back() /= myVoltage;
-			} else if ( *token_pit == "<" ) {
-				myVoltageStack.back() = min(myVoltageStack.back(), myVoltage);
-			} else if ( *token_pit == ">" ) {
-				myVoltageStack.back() = max(myVoltageStack.back(), myVoltage);
-			} else throw EPowerError("invalid operator: " + *token_pit);
-		} else if ( isalpha((*token_pit)[0]) ) { // power name
-			if ( this->count(*token_pit) > 0 ) { // power definition exists
-				if ( theType == MIN_POWER ) {
-					if ( (*this)[*token_pit]->minVoltage == UNKNOWN_VOLTAGE ) {
+	for ( auto token_pit = myEquation.begin(); token_pit != myEquation.end(); token_pit++ ) {
+		switch ( token_pit->type ) {
+			case NAME_TOKEN: { // power name
+				auto power_pit = find(token_pit->text);
+				if ( power_pit != end() ) { // power definition exists
+					voltage_t myPowerVoltage = UNKNOWN_VOLTAGE;
+					if ( theType == MIN_POWER ) myPowerVoltage = power_pit->second->minVoltage;
+					if ( theType == SIM_POWER ) myPowerVoltage = power_pit->second->simVoltage;
+					if ( theType == MAX_POWER ) myPowerVoltage = power_pit->second->maxVoltage;
+					if ( myPowerVoltage == UNKNOWN_VOLTAGE ) {
 						myVoltageStack.push_back(UNKNOWN_TOKEN);
 					} else {
-						myVoltageStack.push_back(float((*this)[*token_pit]->minVoltage) / VOLTAGE_SCALE);
+						myVoltageStack.push_back(float(myPowerVoltage) / VOLTAGE_SCALE);
 					}
-				}
-				if ( theType == SIM_POWER ) {
-					if ( (*this)[*token_pit]->simVoltage == UNKNOWN_VOLTAGE ) {
-						myVoltageStack.push_back(UNKNOWN_TOKEN);
+					implicitFamily += "," + token_pit->text;
+				} else if ( token_pit->text.substr(0,4) == "Vth[" && token_pit->text.back() == ']' ){
+					string myModelName = "M " + token_pit->text.substr(4, token_pit->text.length() - 5);
+					if ( theModelListMap.count(myModelName) > 0 ) {
+						if ( theModelListMap[myModelName].Vth == UNKNOWN_VOLTAGE ) {
+							theModelListMap[myModelName].Vth = CalculateVoltage(theModelListMap[myModelName].vthDefinition, SIM_POWER, theModelListMap, false, false);
+							// recursive call fails if contains undefined macros. does not reset implicit power list
+						}
+						myVoltageStack.push_back(float(theModelListMap[myModelName].Vth) / VOLTAGE_SCALE);
 					} else {
-						myVoltageStack.push_back(float((*this)[*token_pit]->simVoltage) / VOLTAGE_SCALE);
+						throw EModelError("power definition error: " + theEquation + " unknown Vth for " + myModelName.substr(2));
 					}
+				} else if ( thePermitUndefinedFlag ){
+					myVoltageStack.push_back(UNKNOWN_TOKEN);
+				} else {
+					throw EPowerError("undefined macro: " + token_pit->text);
 				}
-				if ( theType == MAX_POWER ) {
-					if ( (*this)[*token_pit]->maxVoltage == UNKNOWN_VOLTAGE ) {
-						myVoltageStack.push_back(UNKNOWN_TOKEN);
-					} else {
-						myVoltageStack.push_back(float((*this)[*token_pit]->maxVoltage) / VOLTAGE_SCALE);
+				break;
+			}
+			case NUMBER_TOKEN: {
+				myVoltageStack.push_back(token_pit->value);
+				break;
+			}
+			case INVALID_TOKEN: {
+				throw EPowerError("invalid power calculation token: " + token_pit->text);
+			}
+			default: {
+				if ( myVoltageStack.size() < 2 ) throw EPowerError("invalid equation: " + theEquation);
+				myVoltage = myVoltageStack.back();
+				myVoltageStack.pop_back();
+				bool myIsMinMax = ( token_pit->type == '<' || token_pit->type == '>' );
+				if ( myVoltage == UNKNOWN_TOKEN ) {
+					if ( ! myIsMinMax ) {  // arithmetic with invalid values gives invalid value, min/max keep value on stack
+						myVoltageStack.back() = UNKNOWN_TOKEN;
 					}
-				}
-				implicitFamily += "," + *token_pit;
-			} else if ( (*token_pit).substr(0,4) == "Vth[" && (*token_pit).back() == ']' ){
-				string myModelName = "M " + (*token_pit).substr(4, (*token_pit).length() - 5);
-				if ( theModelListMap.count(myModelName) > 0 ) {
-					if ( theModelListMap[myModelName].Vth == UNKNOWN_VOLTAGE ) {
-						theModelListMap[myModelName].Vth = CalculateVoltage(theModelListMap[myModelName].vthDefinition, SIM_POWER, theModelListMap, false, false);
-						// recursive call fails if contains undefined macros. does not reset implicit power list
+				} else if ( myVoltageStack.back() == UNKNOWN_TOKEN ) {
+					if ( myIsMinMax ) {  // min/max replace with last voltage
+						myVoltageStack.back() = myVoltage;
 					}
-					myVoltageStack.push_back(float(theModelListMap[myModelName].Vth) / VOLTAGE_SCALE);
 				} else {
-					throw EModelError("power definition error: " + theEquation + " unknown Vth for " + myModelName.substr(2));
+					switch ( token_pit->type ) {
+						case '+': { myVoltageStack.back() += myVoltage; break; }
+						case '-': { myVoltageStack.back() -= myVoltage; break; }
+						case '*': { myVoltageStack.back() *= myVoltage; break; }
+						case '/': { myVoltageStack.back() /= myVoltage; break; }
+						case '<': { myVoltageStack.back() = min(myVoltageStack.back(), myVoltage); break; }
+						case '>': { myVoltageStack.back() = max(myVoltageStack.back(), myVoltage); break; }
+					}
 				}
-			} else if ( thePermitUndefinedFlag ){
-				myVoltageStack.push_back(UNKNOWN_TOKEN);
-			} else {
-				throw EPowerError("undefined macro: " + *token_pit);
 			}
-		} else if ( IsValidVoltage_(*token_pit) ) {
-			myVoltageStack.push_back(from_string<float>(*token_pit));
-		} else {
-			throw EPowerError("invalid power calculation token: " + *token_pit);
 		}
 	}
-	delete myTokenList_p;
 	if ( myVoltageStack.size() != 1 ) throw EPowerError("invalid equation: " + theEquation);
 	if ( myVoltageStack.front() > float(MAX_VOLTAGE) ) {
 		cout << "Warning: equation contains undefined tokens: " << theEquation << endl;
@@ -28,6 +28,7 @@
 #include "CSet.hh"
 #include "CModel.hh"
 #include "CFixedText.hh"
+#include "CEquation.hh"
 
 class CCvcDb;
 class CEventQueue;
@@ -36,7 +37,6 @@ class CVirtualNetVector;
 // status type bits
 enum powerType_t : unsigned char { POWER_BIT=0, INPUT_BIT, HIZ_BIT, RESISTOR_BIT, ANALOG_BIT, MIN_CALCULATED_BIT, SIM_CALCULATED_BIT, MAX_CALCULATED_BIT };
 enum activeType_t : unsigned char { MIN_ACTIVE=0, MAX_ACTIVE, MIN_IGNORE, MAX_IGNORE };
-enum powerPtrType_t : unsigned char { UNKNOWN_POWER_PTR=0, FULL_POWER_PTR, MIN_POWER_PTR, SIM_POWER_PTR, MAX_POWER_PTR };
 
 enum calculationType_t : unsigned char { UNKNOWN_CALCULATION=0, NO_CALCULATION, UP_CALCULATION, DOWN_CALCULATION, RESISTOR_CALCULATION, ESTIMATED_CALCULATION };
 
@@ -71,6 +71,33 @@ public:
 
 class CPower;  // forward declaration
 
+class CPowerPool {
+	// fixed size slabs for power objects. deleted objects are reused. Release() frees everything at once.
+	// slabs are aligned to their size and slot 0 holds the slab index, so each object has a 32 bit handle.
+public:
+	static const int slabShift = 12;
+	static const uint32_t slabSize = 1 << slabShift;  // slots per slab
+	vector<char *> slab_v;
+	void * freeList_p = NULL;
+	size_t slotSize = 0;
+	uintptr_t slabAlignment = 0;
+	uint32_t nextSlot = slabSize;
+	size_t liveCount = 0;
+
+	~CPowerPool();
+	void * Allocate(size_t theSize);
+	void Free(void * theObject_p);
+	void Release();
+	inline CPower * Pointer(uint32_t theHandle) {
+		return ( theHandle == 0 ) ? NULL : reinterpret_cast<CPower *>(slab_v[theHandle >> slabShift] + slotSize * (theHandle & (slabSize - 1)));
+	}
+	inline uint32_t Handle(const void * theObject_p) {
+		if ( ! theObject_p ) return 0;
+		uintptr_t mySlab = reinterpret_cast<uintptr_t>(theObject_p) & ~(slabAlignment - 1);
+		return ( *reinterpret_cast<uint32_t *>(mySlab) << slabShift ) + ( reinterpret_cast<uintptr_t>(theObject_p) - mySlab ) / slotSize;
+	}
+};
+
 class CMiniPower {
 public:
 	static CFixedText powerDefinitionText;
@@ -118,6 +145,7 @@ class CPower {
 public:
 	static netId_t powerCount;
 	static CFixedText powerDefinitionText;
+	static CPowerPool powerPool;
 
 	voltage_t	minVoltage = UNKNOWN_VOLTAGE;
 	voltage_t	simVoltage = UNKNOWN_VOLTAGE;
@@ -149,6 +177,8 @@ public:
 	CPower(netId_t theNetId, voltage_t theSimVoltage, bool theCreateExtraData = false);
 	CPower(netId_t theNetId, voltage_t theMinVoltage, voltage_t theSimVoltage, voltage_t theMaxVoltage, netId_t theDefaultMinNet, netId_t theDefaultSimNet, netId_t theDefaultMaxNet);
 	~CPower();
+	static void * operator new(size_t theSize) { return powerPool.Allocate(theSize); };
+	static void operator delete(void * thePower_p) { powerPool.Free(thePower_p); };
 
 	string expectedSim() { return (( extraData ) ? extraData->expectedSim : ""); };
 	string expectedMin() { return (( extraData ) ? extraData->expectedMin : ""); };
@@ -186,7 +216,7 @@ public:
 	CPowerPtrMap(float theLoadFactor = DEFAULT_LOAD_FACTOR) {max_load_factor(theLoadFactor);}
 	void Clear();
 	string CalculateExpectedValue(string theEquation, netStatus_t theType, CModelListMap & theModelListMap);
-	voltage_t CalculateVoltage(string theEquation, netStatus_t theType, CModelListMap & theModelListMap, bool thePermitUndefinedFlag = false, bool theResetImplicitFlag = true);
+	voltage_t CalculateVoltage(const string & theEquation, netStatus_t theType, CModelListMap & theModelListMap, bool thePermitUndefinedFlag = false, bool theResetImplicitFlag = true);
 };
 
 class CPowerPtrVector;  // forward definition
@@ -204,15 +234,22 @@ public:
 	void SetFamilies(CPowerFamilyMap & thePowerFamilyMap);
 };
 
-union PowerPtr_t {
-	CPower * full;
-	CMiniPower * mini;
+class CPowerHandle {
+	// 4 byte reference to a CPower in CPower::powerPool. used like a CPower pointer. 0 is NULL.
+	uint32_t handle = 0;
+public:
+	inline operator CPower * () const { return CPower::powerPool.Pointer(handle); };
+	inline CPower * operator-> () const { return CPower::powerPool.Pointer(handle); };
+	inline CPowerHandle & operator= (CPower * thePower_p) { handle = CPower::powerPool.Handle(thePower_p); return *this; };
+};
+
+class PowerPtr_t {
+public:
+	CPowerHandle full;
 };
 
 class CPowerPtrVector : public vector<PowerPtr_t> {
 public:
-	vector<powerPtrType_t> powerPtrType_v;
-	
 	voltage_t MaxVoltage(netId_t theNetId);
 	voltage_t MinVoltage(netId_t theNetId);
 	voltage_t SimVoltage(netId_t theNetId);
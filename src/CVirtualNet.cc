@@ -26,10 +26,6 @@
 
 using namespace mmap_allocator_namespace;
 
-extern long gVirtualNetUpdateCount;
-extern long gVirtualNetAccessCount;
-
-
 void CVirtualNet::operator= (CVirtualNet& theEqualNet) {
 	nextNetId = theEqualNet.nextNetId;
 	resistance = theEqualNet.resistance;
@@ -43,12 +39,12 @@ CVirtualNet& CVirtualNet::operator() (CVirtualNetVector& theVirtualNet_v, netId_
 		nextNetId = finalNetId = UNKNOWN_NET;
 		resistance = finalResistance = INFINITE_RESISTANCE;
 	} else {
-		gVirtualNetAccessCount++;
+		theVirtualNet_v.accessCount++;
 		nextNetId = theVirtualNet_v[theNetId].nextNetId;
 		resistance = theVirtualNet_v[theNetId].resistance;
 		if ( theVirtualNet_v.lastUpdate_v.size() > 0
 				&& theVirtualNet_v.lastUpdate_v[theNetId] < theVirtualNet_v.lastUpdate ) {
-			gVirtualNetUpdateCount++;
+			theVirtualNet_v.updateCount++;
 			int myLinkCount = 0;
 			finalNetId = theNetId;
 			finalResistance = 0;
@@ -68,6 +68,8 @@ public:
 	eventKey_t lastUpdate;
 	vector<eventKey_t> lastUpdate_v;
 	powerType_t calculatedBit;
+	long accessCount = 0;  // final net lookups
+	long updateCount = 0;  // final net recalculations
 
 	CVirtualNetVector(powerType_t theCalculatedBit) : calculatedBit(theCalculatedBit) {};
 
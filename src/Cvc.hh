@@ -31,11 +31,6 @@ extern bool gSetup_cvc;
 extern bool gInterrupted;
 extern bool gInteractive_cvc;
 
-// valid voltage globals
-extern char vv_sign;
-extern int vv_integer, vv_fraction;
-extern char vv_suffix[], vv_trailer[];
-
 #include "CvcTypes.hh"
 
 #include <stddef.h>
@@ -64,6 +59,7 @@ extern char vv_suffix[], vv_trailer[];
 #include <iomanip>
 #include <set>
 #include <regex>
+#include <algorithm>
 
 #include "sys/resource.h"
 
@@ -140,7 +136,7 @@ public:
 
 class CFixedText;
 
-class CTextList : public list<text_t> {
+class CTextList : public vector<text_t> {  // contiguous, so short parser lists need one allocation
 public:
 	text_t BiasNet(CFixedText & theCdlText);
 };
@@ -157,6 +153,15 @@ public:
 	CTextNetIdMap(float theLoadFactor = DEFAULT_LOAD_FACTOR) {max_load_factor(theLoadFactor);}
 };
 
+class CTextNetIdArray : public vector<pair<text_t, netId_t>> {
+	// immutable text to net id map sorted by text address. built from a CTextNetIdMap by Freeze
+public:
+	void Freeze(CTextNetIdMap & theMap);
+	const_iterator find(text_t theText) const;
+	inline size_t count(text_t theText) const { return ( find(theText) == end() ) ? 0 : 1; }
+	netId_t at(text_t theText) const;
+};
+
 class CTextDeviceIdMap : public unordered_map<text_t, deviceId_t> {
 public:
 	CTextDeviceIdMap(float theLoadFactor = DEFAULT_LOAD_FACTOR) {max_load_factor(theLoadFactor);}
@@ -176,6 +181,22 @@ class CNetIdVector : public vector<netId_t> {
 public:
 };
 
+class CNetIdSpan {
+	// view of net ids stored in a shared pool (see CCircuit::signalIdPool_v)
+	netId_t *	data_p = NULL;
+	netId_t	count = 0;
+public:
+	inline void Set(netId_t * theData_p, netId_t theCount) { data_p = theData_p; count = theCount; }
+	inline netId_t size() const { return count; }
+	inline bool empty() const { return count == 0; }
+	inline netId_t & operator[](size_t theIndex) { return data_p[theIndex]; }
+	inline const netId_t & operator[](size_t theIndex) const { return data_p[theIndex]; }
+	inline netId_t * begin() { return data_p; }
+	inline netId_t * end() { return data_p + count; }
+	inline bool operator==(const CNetIdSpan & theOther) const { return count == theOther.count && equal(data_p, data_p + count, theOther.data_p); }
+	inline bool operator!=(const CNetIdSpan & theOther) const { return ! (*this == theOther); }
+};
+
 class CDeviceIdVector : public vector<deviceId_t> {
 public:
 };
@@ -191,8 +212,88 @@ public:
 typedef bitset<8> CStatus;
 extern CStatus PMOS_ONLY, NMOS_ONLY, NMOS_PMOS, NO_TYPE; //, MIN_CHECK_BITS, MAX_CHECK_BITS;
 
-class CStatusVector : public vector<CStatus> {
+class CBitVector {
+	// packed bits with word level fill, count and search
 public:
+	vector<uint64_t> word_v;
+	size_t bitCount = 0;
+
+	class reference {
+		uint64_t & word;
+		const uint64_t mask;
+	public:
+		reference(uint64_t & theWord, size_t theIndex) : word(theWord), mask(uint64_t(1) << (theIndex & 63)) {}
+		inline operator bool() const { return (word & mask) != 0; }
+		inline reference & operator= (bool theValue) { if ( theValue ) word |= mask; else word &= ~mask; return *this; }
+		inline reference & operator= (const reference & theBit) { return (*this = bool(theBit)); }
+	};
+
+	CBitVector(size_t theSize = 0, bool theDefault = false) { resize(theSize, theDefault); }
+	inline size_t size() const { return bitCount; }
+	inline void clear() { word_v.clear(); bitCount = 0; }
+	inline void reserve(size_t theSize) { word_v.reserve((theSize + 63) >> 6); }
+	inline void shrink_to_fit() { word_v.shrink_to_fit(); }
+	void resize(size_t theSize, bool theDefault = false);
+	inline bool operator[] (size_t theIndex) const { return (word_v[theIndex >> 6] >> (theIndex & 63)) & 1; }
+	inline reference operator[] (size_t theIndex) { return reference(word_v[theIndex >> 6], theIndex); }
+	void Fill(bool theValue);
+	size_t Count() const;
+	size_t FindNext(size_t theIndex, bool theValue = true) const;
+};
+
+class CStatusVector {
+	// one bit plane per status bit. [index][bit] reads and writes like vector<CStatus>
+public:
+	static const size_t planeCount = 8;  // CStatus size
+	CBitVector plane_v[planeCount];
+
+	class reference {
+		CStatusVector & status_v;
+		const size_t index;
+	public:
+		reference(CStatusVector & theStatus_v, size_t theIndex) : status_v(theStatus_v), index(theIndex) {}
+		inline CBitVector::reference operator[] (size_t theBit) { return status_v.plane_v[theBit][index]; }
+		operator CStatus() const;
+		reference & operator= (const CStatus & theStatus);
+	};
+
+	inline size_t size() const { return plane_v[0].size(); }
+	void clear();
+	void reserve(size_t theSize);
+	void resize(size_t theSize, CStatus theDefault = 0);
+	inline reference operator[] (size_t theIndex) { return reference(*this, theIndex); }
+	inline void CopyBit(size_t theFromBit, size_t theToBit) { plane_v[theToBit].word_v = plane_v[theFromBit].word_v; }
+	inline size_t Count(size_t theBit) const { return plane_v[theBit].Count(); }
+	inline size_t FindNext(size_t theBit, size_t theIndex, bool theValue = true) const { return plane_v[theBit].FindNext(theIndex, theValue); }
+};
+
+class CParentIndex {
+	// parent instance of each net or device.
+	// ids of an instance are consecutive, so the compact form keeps only range starts with a block table to limit the search.
+	CInstanceIdVector	parent_v;  // flat: one parent per id
+	vector<uint32_t>	rangeStart_v;  // compact: first id of each range
+	CInstanceIdVector	rangeParent_v;  // compact: parent of each range
+	vector<uint32_t>	block_v;  // compact: range containing the first id of each block
+	size_t	idCount = 0;
+	bool	compact = false;
+public:
+	static const int blockBits = 6;
+
+	void Reset(bool theCompact);
+	void reserve(size_t theSize);
+	void resize(size_t theSize, instanceId_t theParent);  // ids up to theSize have parent theParent
+	void shrink_to_fit();
+	inline size_t size() const { return idCount; }
+	inline instanceId_t operator[] (size_t theId) const {
+		if ( ! compact ) return parent_v[theId];
+		size_t myBlock = theId >> blockBits;
+		uint32_t myFirst = block_v[myBlock];
+		uint32_t myLast = ( myBlock + 1 < block_v.size() ) ? block_v[myBlock + 1] : rangeStart_v.size() - 1;
+		// the containing range is the last range in [myFirst, myLast] that starts at or before theId
+		return rangeParent_v[upper_bound(rangeStart_v.begin() + myFirst + 1, rangeStart_v.begin() + myLast + 1, theId) - rangeStart_v.begin() - 1];
+	}
+	inline size_t RangeCount() const { return rangeStart_v.size(); }
+	size_t MemorySize() const;
 };
 
 #define IGNORE_WARNINGS	false
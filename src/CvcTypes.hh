@@ -30,6 +30,9 @@
 #include <cstring>
 #include <stdexcept>
 #include <cstdlib>
+#include <cctype>
+#include <climits>
+#include <limits>
 #include <unordered_map>
 
 #ifndef INT64_MAX
@@ -70,8 +73,6 @@ typedef int32_t eventKey_t;
 #define DEFAULT_RESISTANCE "R"
 #define DEFAULT_UNKNOWN_RESISTANCE 1100100
 
-#define MAX_PARALLEL_CIRCUIT_PORT_LIMIT 10
- 
 #define HIERARCHY_DELIMITER	"/"
 #define ALIAS_DELIMITER "~>"
 
@@ -85,29 +86,48 @@ typedef int32_t eventKey_t;
 #define IsGreaterVoltage_(theFirstVoltage, theSecondVoltage) (theFirstVoltage != UNKNOWN_VOLTAGE && theSecondVoltage != UNKNOWN_VOLTAGE && theFirstVoltage > theSecondVoltage)
 #define IsGreaterOrEqualVoltage_(theFirstVoltage, theSecondVoltage) (theFirstVoltage != UNKNOWN_VOLTAGE && theSecondVoltage != UNKNOWN_VOLTAGE && theFirstVoltage >= theSecondVoltage)
 
+// Allocation free number parsing (see utility.cc).
+// ParseNumber reads a number in stream extraction format and returns the next character.
+// Returns NULL if there is no number or the number is out of range (theValue is then 0 or the limit).
+const char * ParseNumber(const char * theText, float & theValue);
+const char * ParseNumber(const char * theText, double & theValue);
+template <typename T> const char * ParseNumber(const char * theText, T & theValue) {
+	const char * myText = theText;
+	bool myNegative = ( *myText == '-' );
+	if ( *myText == '-' || *myText == '+' ) myText++;
+	theValue = 0;
+	if ( ! isdigit(*myText) ) return NULL;
+	unsigned long long myMagnitude = 0;
+	bool myOverflow = false;
+	for ( ; isdigit(*myText); myText++ ) {
+		if ( myMagnitude > ( ULLONG_MAX - 9 ) / 10 ) {
+			myOverflow = true;
+		} else {
+			myMagnitude = myMagnitude * 10 + ( *myText - '0' );
+		}
+	}
+	unsigned long long myLimit = std::numeric_limits<T>::max();
+	if ( std::numeric_limits<T>::is_signed && myNegative ) myLimit++;
+	if ( myOverflow || myMagnitude > myLimit ) {
+		theValue = ( std::numeric_limits<T>::is_signed && myNegative ) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+		return NULL;
+	}
+	theValue = ( myNegative ) ? T(0ULL - myMagnitude) : T(myMagnitude);  // unsigned types wrap like stream extraction
+	return myText;
+}
+// Multiplier for a single character SI suffix followed by white space or end of string. Throws out_of_range for others.
+float SiSuffixScale(const char * theSuffix);
+
 template <typename T> T from_string(std::string const & s) {
-	std::stringstream ss(s);
+	/// Same result as stream extraction followed by an optional SI suffix token.
+	const char * myText = s.c_str();
+	while ( isspace(*myText) ) myText++;
 	T result;
-	static const std::unordered_map<std::string, float> SISuffix = {
-		{"a", 1e-18},
-		{"f", 1e-15},
-		{"p", 1e-12},
-		{"n", 1e-9},
-		{"u", 1e-6},
-		{"m", 1e-3},
-		{"k", 1e3},
-		{"K", 1e3},
-		{"M", 1e6},
-		{"G", 1e9},
-		{"T", 1e12},
-		{"P", 1e15},
-		{"E", 1e18}
-	};
-	std::string mySuffix = "";
-	ss >> result;	// TODO handle errors
-	ss >> mySuffix;
-	if ( mySuffix != "" ) {
-		result = result * SISuffix.at(mySuffix);
+	const char * myEnd = ParseNumber(myText, result);
+	if ( myEnd == NULL ) return result;
+	while ( isspace(*myEnd) ) myEnd++;
+	if ( *myEnd != '\0' ) {
+		result = result * SiSuffixScale(myEnd);
 	}
 	return result;
 }
@@ -143,6 +163,8 @@ enum propagation_t { POWER_NETS_ONLY = 1, ALL_NETS_NO_FUSE, ALL_NETS_AND_FUSE };
 enum cvcError_t { LEAK = 0, HIZ_INPUT, FORWARD_DIODE, NMOS_SOURCE_BULK, NMOS_GATE_SOURCE, NMOS_POSSIBLE_LEAK,
 	PMOS_SOURCE_BULK, PMOS_GATE_SOURCE, PMOS_POSSIBLE_LEAK, OVERVOLTAGE_VBG, OVERVOLTAGE_VBS, OVERVOLTAGE_VDS,
 	OVERVOLTAGE_VGS, MODEL_CHECK, EXPECTED_VOLTAGE, LDD_SOURCE, MIN_VOLTAGE_CONFLICT, MAX_VOLTAGE_CONFLICT, FUSE_ERROR, ERROR_TYPE_COUNT };
+// source/bulk errors are counted in the same device pass as gate/source errors, so use separate circuit error counts
+#define SOURCE_BULK_ERROR_SUBINDEX	1
 // Flag Constants
 
 #define PRINT_CIRCUIT_ON	true
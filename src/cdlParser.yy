@@ -123,8 +123,9 @@ circuit:
 /**/
 		$circuit = new CCircuit();
 		$circuit->name = $interface->front();
-		$interface->pop_front();
+		$interface->erase($interface->begin());
 		$circuit->AddPortSignalIds($interface);
+		$circuit->FreezeSignalIds();
 /**/
 		delete $interface;
 //		$circuit = NULL;
@@ -132,11 +133,12 @@ circuit:
 |	SUBCKT interface deviceList ends {
 		$circuit = new CCircuit();
 		$circuit->name = $interface->front();
-		$interface->pop_front();
+		$interface->erase($interface->begin());
 		$circuit->AddPortSignalIds($interface);
 		delete $interface;
 //		$circuit->devices = $deviceList;
 		$circuit->LoadDevices($deviceList);
+		$circuit->FreezeSignalIds();
 //		delete $deviceList;
 //		for (CDeviceList::iterator current = $circuit->devices->begin(); current != $circuit->devices->end(); current++ ) {
 //			current->signalIndexVector = $circuit->SetSignalIndexes(current->signals);
@@ -189,23 +191,20 @@ device:
 subcircuit:
 	SUBCIRCUIT stringList EOL {
 //		printf("** NOERROR: found subckt: %s\n", $SUBCIRCUIT);
-		$subcircuit = new CDevice();
+		$subcircuit = cdlCircuitList.deviceArena.New();
 		$subcircuit->name = $SUBCIRCUIT;
-		char * myString = $stringList->back();
-		$stringList->pop_back();
-		CTextList * myParameterList = new CTextList;
-		while( strchr(myString, '=') ) {
-			myParameterList->push_front(myString);
-			myString = $stringList->back();
-			$stringList->pop_back();
-		}	
-		$subcircuit->masterName = myString;
-		$subcircuit->signalList_p = $stringList;
-		if ( ! myParameterList->empty() ) {
-			myParameterList->push_front(myString);  // add box model name
-			$subcircuit->parameters = cdlCircuitList.parameterText.SetTextAddress("X", myParameterList);
+		size_t myMasterIndex = $stringList->size() - 1;
+		while( strchr((*$stringList)[myMasterIndex], '=') ) {  // trailing parameters
+			myMasterIndex--;
+		}
+		$subcircuit->masterName = (*$stringList)[myMasterIndex];
+		if ( myMasterIndex + 1 < $stringList->size() ) {
+			CTextList myParameterList;  // box model name and parameters
+			myParameterList.assign($stringList->begin() + myMasterIndex, $stringList->end());
+			$subcircuit->parameters = cdlCircuitList.parameterText.SetTextAddress("X", &myParameterList);
 		}
-		delete myParameterList;
+		$stringList->resize(myMasterIndex);
+		$subcircuit->signalList_p = $stringList;
 	};
 
 bipolar:
@@ -216,9 +215,10 @@ bipolar:
 		$bipolar = NULL;
 */
 /**/
-		$bipolar = new CDevice();
+		$bipolar = cdlCircuitList.deviceArena.New();
 		$bipolar->name = $BIPOLAR;
 		$bipolar->signalList_p = new CTextList();
+		$bipolar->signalList_p->reserve(4);
 		$bipolar->AppendSignal($collector);
 		$bipolar->AppendSignal($base);
 		$bipolar->AppendSignal($emitter);
@@ -229,9 +229,10 @@ bipolar:
 
 capacitor:
 	CAPACITOR STRING[plus] STRING[minus] stringList EOL {
-		$capacitor = new CDevice();
+		$capacitor = cdlCircuitList.deviceArena.New();
 		$capacitor->name = $CAPACITOR;
 		$capacitor->signalList_p = new CTextList();
+		$capacitor->signalList_p->reserve(4);
 		$capacitor->AppendSignal($plus);
 		$capacitor->AppendSignal($minus);
 		$capacitor->AppendSignal($stringList->BiasNet(cdlCircuitList.cdlText));
@@ -247,11 +248,12 @@ capacitor:
 
 diode:
 	DIODE STRING[anode] STRING[cathode] stringList EOL {
-		$diode = new CDevice();
+		$diode = cdlCircuitList.deviceArena.New();
 		$diode->name = $DIODE;
 		$diode->sourceDrainSet = true;
 		$diode->sourceDrainSwapOk = false;
 		$diode->signalList_p = new CTextList();
+		$diode->signalList_p->reserve(4);
 		$diode->AppendSignal($anode);
 		$diode->AppendSignal($cathode);
 		$diode->parameters = cdlCircuitList.parameterText.SetTextAddress("D", $stringList);		
@@ -275,9 +277,10 @@ inductor:
 
 mosfet:
 	MOSFET STRING[drain] STRING[gate] STRING[source] STRING[bulk] stringList EOL {
-		$mosfet = new CDevice();
+		$mosfet = cdlCircuitList.deviceArena.New();
 		$mosfet->name = $MOSFET;
 		$mosfet->signalList_p = new CTextList();
+		$mosfet->signalList_p->reserve(4);
 		$mosfet->AppendSignal($drain);
 		$mosfet->AppendSignal($gate);
 		$mosfet->AppendSignal($source);
@@ -290,9 +293,10 @@ mosfet:
 
 resistor:
 	RESISTOR STRING[plus] STRING[minus] stringList EOL {
-		$resistor = new CDevice();
+		$resistor = cdlCircuitList.deviceArena.New();
 		$resistor->name = $RESISTOR;
 		$resistor->signalList_p = new CTextList();
+		$resistor->signalList_p->reserve(4);
 		$resistor->AppendSignal($plus);
 		$resistor->AppendSignal($minus);
 		$resistor->AppendSignal($stringList->BiasNet(cdlCircuitList.cdlText));
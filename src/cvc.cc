@@ -30,13 +30,6 @@
 #include <readline/readline.h>
 #include <readline/history.h>
 
-/// \name vv_* : valid voltage globals
-///@{
-char vv_sign;
-int vv_integer, vv_fraction;
-char vv_suffix[2], vv_trailer[2];
-///@}
-
 bool gDebug_cvc = false;
 bool gSetup_cvc = false;
 bool gInterrupted = false;  //!< for detecting interrupts
@@ -56,6 +49,8 @@ string EResistanceError::displayMessage = "";
 ///@{
 CStatus PMOS_ONLY, NMOS_ONLY, NMOS_PMOS, NO_TYPE; //, MIN_CHECK_BITS, MAX_CHECK_BITS;
 set<modelType_t> FUSE_MODELS;
+set<modelType_t> NMOS_MODELS;
+set<modelType_t> PMOS_MODELS;
 CNetIdSet EmptySet;
 ///@}
 
@@ -80,6 +75,10 @@ int main(int argc, const char * argv[]) {
 	NO_TYPE = 0;
 	FUSE_MODELS.insert(FUSE_ON);
 	FUSE_MODELS.insert(FUSE_OFF);
+	NMOS_MODELS.insert(NMOS);
+	NMOS_MODELS.insert(LDDN);
+	PMOS_MODELS.insert(PMOS);
+	PMOS_MODELS.insert(LDDP);
 
 try {
 	using_history();
@@ -246,3 +246,223 @@ bool IsAlphanumeric(std::string theString) {
 	}
 	return true;
 }
+
+void CBitVector::resize(size_t theSize, bool theDefault) {
+	// new bits are set to theDefault
+	size_t myOldSize = bitCount;
+	if ( theSize > myOldSize && ( myOldSize & 63 ) ) {  // fill the rest of the partial last word
+		uint64_t myMask = ~uint64_t(0) << ( myOldSize & 63 );
+		if ( theDefault ) word_v.back() |= myMask; else word_v.back() &= ~myMask;
+	}
+	word_v.resize((theSize + 63) >> 6, theDefault ? ~uint64_t(0) : 0);
+	bitCount = theSize;
+	if ( theSize & 63 ) word_v.back() &= ~( ~uint64_t(0) << ( theSize & 63 ) );  // unused bits are always 0
+}
+
+void CBitVector::Fill(bool theValue) {
+	for ( auto word_pit = word_v.begin(); word_pit != word_v.end(); word_pit++ ) {
+		*word_pit = theValue ? ~uint64_t(0) : 0;
+	}
+	if ( theValue && ( bitCount & 63 ) ) word_v.back() &= ~( ~uint64_t(0) << ( bitCount & 63 ) );
+}
+
+size_t CBitVector::Count() const {
+	size_t myCount = 0;
+	for ( auto word_pit = word_v.begin(); word_pit != word_v.end(); word_pit++ ) {
+		myCount += __builtin_popcountll(*word_pit);
+	}
+	return myCount;
+}
+
+size_t CBitVector::FindNext(size_t theIndex, bool theValue) const {
+	/// Returns the first index >= theIndex with bit equal to theValue, or size() if none. Skips whole words.
+	if ( theIndex >= bitCount ) return bitCount;
+	size_t myWord = theIndex >> 6;
+	uint64_t myBits = ( theValue ? word_v[myWord] : ~word_v[myWord] ) & ( ~uint64_t(0) << ( theIndex & 63 ) );
+	while ( myBits == 0 ) {
+		if ( ++myWord >= word_v.size() ) return bitCount;
+		myBits = theValue ? word_v[myWord] : ~word_v[myWord];
+	}
+	return min(bitCount, ( myWord << 6 ) + __builtin_ctzll(myBits));
+}
+
+CStatusVector::reference::operator CStatus() const {
+	CStatus myStatus;
+	for ( size_t bit_it = 0; bit_it < planeCount; bit_it++ ) {
+		myStatus[bit_it] = status_v.plane_v[bit_it][index];
+	}
+	return myStatus;
+}
+
+CStatusVector::reference & CStatusVector::reference::operator= (const CStatus & theStatus) {
+	for ( size_t bit_it = 0; bit_it < planeCount; bit_it++ ) {
+		status_v.plane_v[bit_it][index] = theStatus[bit_it];
+	}
+	return *this;
+}
+
+void CStatusVector::clear() {
+	for ( size_t bit_it = 0; bit_it < planeCount; bit_it++ ) {
+		plane_v[bit_it].clear();
+	}
+}
+
+void CStatusVector::reserve(size_t theSize) {
+	for ( size_t bit_it = 0; bit_it < planeCount; bit_it++ ) {
+		plane_v[bit_it].reserve(theSize);
+	}
+}
+
+void CStatusVector::resize(size_t theSize, CStatus theDefault) {
+	for ( size_t bit_it = 0; bit_it < planeCount; bit_it++ ) {
+		plane_v[bit_it].resize(theSize, theDefault[bit_it]);
+	}
+}
+
+void CParentIndex::Reset(bool theCompact) {
+	parent_v.clear();
+	parent_v.shrink_to_fit();
+	rangeStart_v.clear();
+	rangeParent_v.clear();
+	block_v.clear();
+	idCount = 0;
+	compact = theCompact;
+}
+
+void CParentIndex::reserve(size_t theSize) {
+	if ( ! compact ) parent_v.reserve(theSize);
+}
+
+void CParentIndex::resize(size_t theSize, instanceId_t theParent) {
+	/// Only appends. Ids from size() to theSize are assigned to theParent.
+	assert(theSize >= idCount);
+	if ( ! compact ) {
+		parent_v.resize(theSize, theParent);
+	} else if ( theSize > idCount ) {
+		if ( rangeParent_v.empty() || rangeParent_v.back() != theParent ) {
+			rangeStart_v.push_back(idCount);
+			rangeParent_v.push_back(theParent);
+		}
+		while ( ( block_v.size() << blockBits ) < theSize ) {  // new blocks start in the last range
+			block_v.push_back(rangeStart_v.size() - 1);
+		}
+	}
+	idCount = theSize;
+}
+
+void CParentIndex::shrink_to_fit() {
+	parent_v.shrink_to_fit();
+	rangeStart_v.shrink_to_fit();
+	rangeParent_v.shrink_to_fit();
+	block_v.shrink_to_fit();
+}
+
+size_t CParentIndex::MemorySize() const {
+	return ( parent_v.capacity() + rangeParent_v.capacity() ) * sizeof(instanceId_t)
+		+ ( rangeStart_v.capacity() + block_v.capacity() ) * sizeof(uint32_t);
+}
+
+void CTextNetIdArray::Freeze(CTextNetIdMap & theMap) {
+	/// Copies theMap into a sorted array and releases theMap.
+	assign(theMap.begin(), theMap.end());
+	sort(begin(), end(), [](const value_type & theLeft, const value_type & theRight) { return less<text_t>()(theLeft.first, theRight.first); });
+	shrink_to_fit();
+	CTextNetIdMap().swap(theMap);
+}
+
+CTextNetIdArray::const_iterator CTextNetIdArray::find(text_t theText) const {
+	const_iterator myFind = lower_bound(begin(), end(), theText, [](const value_type & theElement, text_t theKey) { return less<text_t>()(theElement.first, theKey); });
+	return ( myFind != end() && myFind->first == theText ) ? myFind : end();
+}
+
+netId_t CTextNetIdArray::at(text_t theText) const {
+	const_iterator myFind = find(theText);
+	if ( myFind == end() ) throw out_of_range("text not in net id array");
+	return myFind->second;
+}
+
+static const char * ScanReal(const char * theText) {
+	/// End of the real number at theText in stream extraction format, or theText if there is none.
+	const char * myText = theText;
+	if ( *myText == '-' || *myText == '+' ) myText++;
+	bool myHasDigits = isdigit(*myText);
+	while ( isdigit(*myText) ) myText++;
+	if ( *myText == '.' ) {
+		myText++;
+		if ( isdigit(*myText) ) myHasDigits = true;
+		while ( isdigit(*myText) ) myText++;
+	}
+	if ( ! myHasDigits ) return theText;
+	if ( *myText == 'e' || *myText == 'E' ) {
+		myText++;
+		if ( *myText == '-' || *myText == '+' ) myText++;
+		if ( ! isdigit(*myText) ) return theText;  // incomplete exponent fails like stream extraction
+		while ( isdigit(*myText) ) myText++;
+	}
+	return myText;
+}
+
+template <typename T> const char * ParseReal(const char * theText, T & theValue, T (*theConvert)(const char *, char **)) {
+	const char * myEnd = ScanReal(theText);
+	theValue = 0;
+	if ( myEnd == theText ) return NULL;
+	char myBuffer[64];  // copy, so that strtod does not read hex or other formats past the scanned number
+	size_t myLength = myEnd - theText;
+	if ( myLength < sizeof(myBuffer) ) {
+		memcpy(myBuffer, theText, myLength);
+		myBuffer[myLength] = '\0';
+		theValue = theConvert(myBuffer, NULL);
+	} else {
+		theValue = theConvert(string(theText, myLength).c_str(), NULL);
+	}
+	if ( isinf(theValue) ) {  // out of range
+		theValue = ( theValue < 0 ) ? - numeric_limits<T>::max() : numeric_limits<T>::max();
+		return NULL;
+	}
+	return myEnd;
+}
+
+const char * ParseNumber(const char * theText, float & theValue) {
+	return ParseReal<float>(theText, theValue, strtof);
+}
+
+const char * ParseNumber(const char * theText, double & theValue) {
+	return ParseReal<double>(theText, theValue, strtod);
+}
+
+float SiSuffixScale(const char * theSuffix) {
+	if ( theSuffix[0] != '\0' && ( theSuffix[1] == '\0' || isspace(theSuffix[1]) ) ) {
+		switch ( theSuffix[0] ) {  // float, as in earlier versions
+			case 'a': return 1e-18;
+			case 'f': return 1e-15;
+			case 'p': return 1e-12;
+			case 'n': return 1e-9;
+			case 'u': return 1e-6;
+			case 'm': return 1e-3;
+			case 'k': case 'K': return 1e3;
+			case 'M': return 1e6;
+			case 'G': return 1e9;
+			case 'T': return 1e12;
+			case 'P': return 1e15;
+			case 'E': return 1e18;
+		}
+	}
+	throw out_of_range("unknown SI suffix: " + string(theSuffix));
+}
+
+bool IsValidVoltage(const string & theString) {
+	/// [+-]digits[.digits][SI suffix] with optional surrounding white space
+	const char * myText = theString.c_str();
+	while ( isspace(*myText) ) myText++;
+	if ( *myText == '-' || *myText == '+' ) myText++;
+	if ( ! isdigit(*myText) ) return false;
+	while ( isdigit(*myText) ) myText++;
+	if ( *myText == '.' ) {
+		myText++;
+		if ( ! isdigit(*myText) ) return false;
+		while ( isdigit(*myText) ) myText++;
+	}
+	if ( *myText != '\0' && strchr("afpnumkKMGTPE", *myText) ) myText++;
+	while ( isspace(*myText) ) myText++;
+	return ( *myText == '\0' );
+}
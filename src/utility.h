@@ -43,16 +43,8 @@ std::string int_to_hex( T i )
 }
 
 #define trim_(string) (string.substr(0, string.find_last_not_of(" \t\n") + 1).substr(string.find_first_not_of(" \t\n")))
-#define IsValidVoltage_(string) (\
-		sscanf((string).c_str(), "%[-+]%d.%d%1s", &vv_sign, &vv_integer, &vv_fraction, vv_trailer) == 3 \
-		|| sscanf((string).c_str(), "%[-+]%d%1s", &vv_sign, &vv_integer, vv_trailer) == 2 \
-		|| sscanf((string).c_str(), "%d.%d%1s", &vv_integer, &vv_fraction, vv_trailer) == 2 \
-		|| sscanf((string).c_str(), "%d%1s", &vv_integer, vv_trailer) == 1 \
-		|| sscanf((string).c_str(), "%[-+]%d.%d%1[afpnumkKMGTPE]%1s", &vv_sign, &vv_integer, &vv_fraction, vv_suffix, vv_trailer) == 4 \
-		|| sscanf((string).c_str(), "%[-+]%d%1[afpnumkKMGTPE]%1s", &vv_sign, &vv_integer, vv_suffix, vv_trailer) == 3 \
-		|| sscanf((string).c_str(), "%d.%d%1[afpnumkKMGTPE]%1s", &vv_integer, &vv_fraction, vv_suffix, vv_trailer) == 3 \
-		|| sscanf((string).c_str(), "%d%1[afpnumkKMGTPE]%1s", &vv_integer, vv_suffix, vv_trailer) == 2 \
-)
+bool IsValidVoltage(const std::string & theString);
+#define IsValidVoltage_(string) (IsValidVoltage(string))
 
 char * CurrentTime();
 